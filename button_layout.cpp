@@ -0,0 +1,85 @@
+/*****************************************************************//**
+ * \file   button_layout.cpp
+ * \brief  {^zuiXboxEPlayStationENintendoj̕בւe[u
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "button_layout.h"
+#include <cstring>
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // rbg}XNrbgԍ
+    constexpr uint8_t BitIndex(uint16_t mask) {
+        uint8_t index = 0;
+        while (mask > 1) {
+            mask = static_cast<uint16_t>(mask >> 1);
+            index++;
+        }
+        return index;
+    }
+
+    // Lq
+    // confirm/cancel: ELZɎg̓rbg
+    // labelOrder: ʃ{^ʒuł͂Ȃǂ̃rbgœ͂iA/BEX/Yւj
+    constexpr ButtonLayoutDesc MakeDesc(uint16_t confirm, uint16_t cancel, bool labelOrder) {
+        ButtonLayoutDesc desc = {};
+        for (int i = 0; i < 16; i++) {
+            desc.source[i] = static_cast<uint8_t>(i);
+        }
+        if (labelOrder) {
+            desc.source[BitIndex(PAD_BUTTON_A)] = BitIndex(PAD_BUTTON_B);
+            desc.source[BitIndex(PAD_BUTTON_B)] = BitIndex(PAD_BUTTON_A);
+            desc.source[BitIndex(PAD_BUTTON_X)] = BitIndex(PAD_BUTTON_Y);
+            desc.source[BitIndex(PAD_BUTTON_Y)] = BitIndex(PAD_BUTTON_X);
+        }
+        desc.source[BitIndex(PAD_BUTTON_CONFIRM)] = BitIndex(confirm);
+        desc.source[BitIndex(PAD_BUTTON_CANCEL)] = BitIndex(cancel);
+        return desc;
+    }
+
+    constexpr ButtonLayoutDesc XBOX_DESC = MakeDesc(PAD_BUTTON_A, PAD_BUTTON_B, false);
+    constexpr ButtonLayoutDesc PLAYSTATION_DESC = MakeDesc(PAD_BUTTON_A, PAD_BUTTON_B, false);
+    constexpr ButtonLayoutDesc PLAYSTATION_JP_DESC = MakeDesc(PAD_BUTTON_B, PAD_BUTTON_A, false);
+    constexpr ButtonLayoutDesc NINTENDO_DESC = MakeDesc(PAD_BUTTON_A, PAD_BUTTON_B, true);
+
+    // ʂ̊mFiRpCj
+    constexpr ButtonRemapTable XBOX_CHECK(XBOX_DESC);
+    constexpr ButtonRemapTable PLAYSTATION_JP_CHECK(PLAYSTATION_JP_DESC);
+    constexpr ButtonRemapTable NINTENDO_CHECK(NINTENDO_DESC);
+    static_assert(XBOX_CHECK.Apply(PAD_BUTTON_A) == (PAD_BUTTON_A | PAD_BUTTON_CONFIRM), "xbox A");
+    static_assert(XBOX_CHECK.Apply(PAD_BUTTON_DPAD_UP | PAD_BUTTON_START) == (PAD_BUTTON_DPAD_UP | PAD_BUTTON_START), "xbox identity");
+    static_assert(PLAYSTATION_JP_CHECK.Apply(PAD_BUTTON_B) == (PAD_BUTTON_B | PAD_BUTTON_CONFIRM), "jp circle");
+    static_assert(NINTENDO_CHECK.Apply(PAD_BUTTON_A) == (PAD_BUTTON_B | PAD_BUTTON_CONFIRM), "nintendo A");
+    static_assert(NINTENDO_CHECK.Apply(PAD_BUTTON_X) == PAD_BUTTON_Y, "nintendo X");
+    static_assert(NINTENDO_CHECK.Apply(PAD_BUTTON_CONFIRM | PAD_BUTTON_CANCEL) == 0, "unused input bits");
+}
+
+//==============================================================================
+// RpCς݂̃CAEg
+//==============================================================================
+const ButtonLayout BUTTON_LAYOUTS[BUTTON_LAYOUT_COUNT] = {
+    { "Xbox",           { "A ", "B ", "X ", "Y " }, { "A", "B", "X", "Y" },
+      ButtonRemapTable(XBOX_DESC) },
+    { "PlayStation",    { "~", "", "", "" }, { "CROSS", "CIRCLE", "SQUARE", "TRIANGLE" },
+      ButtonRemapTable(PLAYSTATION_DESC) },
+    { "PlayStation-JP", { "~", "", "", "" }, { "CROSS", "CIRCLE", "SQUARE", "TRIANGLE" },
+      ButtonRemapTable(PLAYSTATION_JP_DESC) },
+    { "Nintendo",       { "B ", "A ", "Y ", "X " }, { "B", "A", "Y", "X" },
+      ButtonRemapTable(NINTENDO_DESC) },
+};
+
+//==============================================================================
+// O烌CAEgT
+//==============================================================================
+bool FindButtonLayout(const char* pName, ButtonLayoutType* pType) {
+    for (int i = 0; i < BUTTON_LAYOUT_COUNT; i++) {
+        if (_stricmp(pName, BUTTON_LAYOUTS[i].pName) == 0) {
+            *pType = static_cast<ButtonLayoutType>(i);
+            return true;
+        }
+    }
+    return false;
+}
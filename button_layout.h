@@ -0,0 +1,82 @@
+/*****************************************************************//**
+ * \file   button_layout.h
+ * \brief  {^zuiXboxEPlayStationENintendoj̕בւe[u
+ *
+ * CAEǵuo̓rbgƂɓ͂̂ǂ̃rbg邩v̋LqŁA
+ * RpCɉʁE8rbgp256vfe[uB
+ * fR[h̓{^̃rbg}XN lo[] | hi[] 1̕\ŕבւB
+ *
+ * בւ́Aʃ{^̃rbg͏ɈʒuiEEEEj\A
+ * PAD_BUTTON_CONFIRM / PAD_BUTTON_CANCEL ɂ̃CAEgł̌ELZB
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+#include "gamepad_state.h"
+
+//==============================================================================
+// CAEg̎
+//==============================================================================
+enum ButtonLayoutType {
+    BUTTON_LAYOUT_XBOX,             // 
+    BUTTON_LAYOUT_PLAYSTATION,      // i~j
+    BUTTON_LAYOUT_PLAYSTATION_JP,   // Eij
+    BUTTON_LAYOUT_NINTENDO,         // EiAjAA/BEX/Y͕ǂ̃rbgœ͂
+    BUTTON_LAYOUT_COUNT
+};
+
+//==============================================================================
+// בւ̋Lqio̓rbgƂ̓̓rbgԍj
+//==============================================================================
+struct ButtonLayoutDesc {
+    static constexpr uint8_t NO_SOURCE = 0xFF;
+    uint8_t source[16];
+};
+
+//==============================================================================
+// בւe[uiRpCɐj
+//==============================================================================
+struct ButtonRemapTable {
+    uint16_t lo[256];
+    uint16_t hi[256];
+
+    constexpr explicit ButtonRemapTable(const ButtonLayoutDesc& desc) : lo(), hi() {
+        for (int value = 0; value < 256; value++) {
+            for (int out = 0; out < 16; out++) {
+                int src = desc.source[out];
+                if (src == ButtonLayoutDesc::NO_SOURCE) continue;
+                uint16_t bit = static_cast<uint16_t>(1 << out);
+                if (src < 8) {
+                    if ((value >> src) & 1) lo[value] = static_cast<uint16_t>(lo[value] | bit);
+                } else {
+                    if ((value >> (src - 8)) & 1) hi[value] = static_cast<uint16_t>(hi[value] | bit);
+                }
+            }
+        }
+    }
+
+    constexpr uint16_t Apply(uint16_t buttons) const {
+        return static_cast<uint16_t>(lo[buttons & 0xFF] | hi[buttons >> 8]);
+    }
+};
+
+//==============================================================================
+// CAEg
+//==============================================================================
+struct ButtonLayout {
+    const char* pName;
+    const char* faceLabels[4];      // EEEE̕\i2j
+    const char* faceNames[4];       // EEEE̖OiCxg\pj
+    ButtonRemapTable remap;
+};
+
+// RpCς݂̃CAEgiButtonLayoutTypȅj
+extern const ButtonLayout BUTTON_LAYOUTS[BUTTON_LAYOUT_COUNT];
+
+inline const ButtonLayout& GetButtonLayout(ButtonLayoutType type) {
+    return BUTTON_LAYOUTS[(type >= 0 && type < BUTTON_LAYOUT_COUNT) ? type : BUTTON_LAYOUT_XBOX];
+}
+
+// O烌CAEgTi啶͋ʂȂAȂfalsej
+bool FindButtonLayout(const char* pName, ButtonLayoutType* pType);
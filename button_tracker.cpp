@@ -0,0 +1,120 @@
+/*****************************************************************//**
+ * \file   button_tracker.cpp
+ * \brief  {^Ƃ̉EԁEAŉ񐔂̒ǐ
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "button_tracker.h"
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // Aŉ񐔂̏iuint8_tɎ߂j
+    constexpr uint8_t MAX_TAP_COUNT = 255;
+}
+
+//==============================================================================
+// 
+//==============================================================================
+void ButtonTracker::Reset() {
+    m_buttons = 0;
+    m_pressed = 0;
+    m_released = 0;
+    m_releasedOnce = 0;
+    m_time = 0;
+    m_prevTime = 0;
+    m_frame = 0;
+    m_tapIntervalUs = DEFAULT_TAP_INTERVAL_US;
+    for (int i = 0; i < BUTTON_COUNT; i++) {
+        m_pressTime[i] = 0;
+        m_releaseTime[i] = 0;
+        m_pressFrame[i] = 0;
+        m_releaseFrame[i] = 0;
+        m_tapCount[i] = 0;
+    }
+}
+
+//==============================================================================
+// XV
+//==============================================================================
+void ButtonTracker::Update(uint32_t buttons, uint64_t timeUs) {
+    m_pressed = buttons & ~m_buttons;
+    m_released = m_buttons & ~buttons;
+    m_buttons = buttons;
+    m_prevTime = m_time;
+    m_time = timeUs;
+    m_frame++;
+
+    // ωrbgiςȂEςȂ͉Ȃj
+    uint32_t changed = m_pressed | m_released;
+    for (int bit = 0; changed != 0; bit++, changed >>= 1) {
+        if ((changed & 1) == 0) {
+            continue;
+        }
+        uint32_t mask = 1u << bit;
+        if (m_pressed & mask) {
+            // O񂪒ZŁAĂ炷ȂAł𑱂
+            bool isTap = (m_releasedOnce & mask) != 0 &&
+                timeUs - m_releaseTime[bit] <= m_tapIntervalUs &&
+                m_releaseTime[bit] - m_pressTime[bit] <= m_tapIntervalUs;
+            if (!isTap) {
+                m_tapCount[bit] = 1;
+            } else if (m_tapCount[bit] < MAX_TAP_COUNT) {
+                m_tapCount[bit]++;
+            }
+            m_pressTime[bit] = timeUs;
+            m_pressFrame[bit] = m_frame;
+        } else {
+            m_releaseTime[bit] = timeUs;
+            m_releaseFrame[bit] = m_frame;
+            m_releasedOnce |= mask;
+        }
+    }
+}
+
+//==============================================================================
+// 
+//==============================================================================
+uint64_t ButtonTracker::GetHeldTime(uint32_t button) const {
+    if (!IsHeld(button)) {
+        return 0;
+    }
+    return m_time - m_pressTime[BitIndex(button)];
+}
+
+uint32_t ButtonTracker::GetHeldFrames(uint32_t button) const {
+    if (!IsHeld(button)) {
+        return 0;
+    }
+    return m_frame - m_pressFrame[BitIndex(button)];
+}
+
+bool ButtonTracker::IsLongPress(uint32_t button, uint64_t durationUs) const {
+    if (!IsHeld(button)) {
+        return false;
+    }
+    uint64_t pressTime = m_pressTime[BitIndex(button)];
+    if (m_time - pressTime < durationUs) {
+        return false;
+    }
+    // t[łBĂidurationUs0jAÕt[ł͂܂BĂȂ
+    return (m_pressed & button) != 0 || m_prevTime - pressTime < durationUs;
+}
+
+//==============================================================================
+// Ă̎
+//==============================================================================
+uint64_t ButtonTracker::GetTimeSinceRelease(uint32_t button) const {
+    if (IsHeld(button) || (m_releasedOnce & button) == 0) {
+        return UINT64_MAX;
+    }
+    return m_time - m_releaseTime[BitIndex(button)];
+}
+
+uint32_t ButtonTracker::GetFramesSinceRelease(uint32_t button) const {
+    if (IsHeld(button) || (m_releasedOnce & button) == 0) {
+        return UINT32_MAX;
+    }
+    return m_frame - m_releaseFrame[BitIndex(button)];
+}
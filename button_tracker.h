@@ -0,0 +1,98 @@
+/*****************************************************************//**
+ * \file   button_tracker.h
+ * \brief  {^Ƃ̉EԁEAŉ񐔂̒ǐ
+ *
+ * u1.5bvuĂ牽t[vu2AŁv̂悤Ȕ
+ * eVXeÕJE^[ŎȂčςނ悤AS{^
+ * Ȕzɂ܂Ƃ߂ĎBUpdate()͉uԁEuԂ̃rbg
+ * 1̃[vŏAςȂ̃{^ɂ͉Ȃ
+ * iԂ͖₢킹̂ƂɎ̍ŋ߂jB
+ *
+ * ₢킹PAD_BUTTON_*i1rbgjŎw肷B
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+
+//==============================================================================
+// {^ǐՃNX
+//==============================================================================
+class ButtonTracker {
+public:
+    // ǐՂ{^̃rbgiPAD_BUTTON_*16rbg{fW^L2/R2j
+    static constexpr int BUTTON_COUNT = 18;
+    // ̘AŊԊuiĂ玟ɉ܂ŁE1̉ԂƂAȓȂAŁj
+    static constexpr uint64_t DEFAULT_TAP_INTERVAL_US = 250000;
+
+    ButtonTracker() { Reset(); }
+
+    void Reset();
+    void SetTapInterval(uint64_t intervalUs) { m_tapIntervalUs = intervalUs; }
+
+    // 1t[̃{^ԂniɌĂԂƁj
+    void Update(uint32_t buttons, uint64_t timeUs);
+
+    //==========================================================================
+    // t[S
+    //==========================================================================
+    uint32_t GetButtons() const { return m_buttons; }
+    uint32_t GetPressedMask() const { return m_pressed; }      // ̃t[ŉ
+    uint32_t GetReleasedMask() const { return m_released; }    // ̃t[ŗ
+    uint64_t GetUpdateTime() const { return m_time; }
+    uint32_t GetFrame() const { return m_frame; }
+
+    //==========================================================================
+    // {^ƁibuttonPAD_BUTTON_*1j
+    //==========================================================================
+    bool IsHeld(uint32_t button) const { return (m_buttons & button) != 0; }
+
+    // Ă̎ԁEt[iĂȂ0j
+    uint64_t GetHeldTime(uint32_t button) const;
+    uint32_t GetHeldFrames(uint32_t button) const;
+    // w莞Ԉȏ㉟Ă
+    bool IsHeldFor(uint32_t button, uint64_t durationUs) const {
+        return IsHeld(button) && GetHeldTime(button) >= durationUs;
+    }
+    // Ďw莞ԂɒBt[true
+    bool IsLongPress(uint32_t button, uint64_t durationUs) const;
+
+    // Ă̎ԁEt[iĂԂƁAxĂȂUINT64_MAX / UINT32_MAXj
+    uint64_t GetTimeSinceRelease(uint32_t button) const;
+    uint32_t GetFramesSinceRelease(uint32_t button) const;
+
+    // Aŉ񐔁iAŊԊu󂯂ɉ񐔁AĂԂŌ̒lۂj
+    int GetTapCount(uint32_t button) const { return m_tapCount[BitIndex(button)]; }
+    // 2ڂt[true
+    bool IsDoubleTap(uint32_t button) const {
+        return (m_pressed & button) != 0 && m_tapCount[BitIndex(button)] == 2;
+    }
+
+    // ŌɉirbgԍŎwAChordDetectorȂǓpj
+    uint64_t GetPressTimeAt(int bit) const { return m_pressTime[bit]; }
+
+private:
+    static int BitIndex(uint32_t button) {
+        int bit = 0;
+        while (bit < BUTTON_COUNT - 1 && (button & (1u << bit)) == 0) {
+            bit++;
+        }
+        return bit;
+    }
+
+    uint32_t m_buttons;
+    uint32_t m_pressed;
+    uint32_t m_released;
+    uint32_t m_releasedOnce;        // xłƂ{^
+    uint64_t m_time;
+    uint64_t m_prevTime;
+    uint32_t m_frame;
+    uint64_t m_tapIntervalUs;
+
+    // {^Ɓirbgԍj
+    uint64_t m_pressTime[BUTTON_COUNT];
+    uint64_t m_releaseTime[BUTTON_COUNT];
+    uint32_t m_pressFrame[BUTTON_COUNT];
+    uint32_t m_releaseFrame[BUTTON_COUNT];
+    uint8_t m_tapCount[BUTTON_COUNT];
+};
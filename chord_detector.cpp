@@ -0,0 +1,126 @@
+/*****************************************************************//**
+ * \file   chord_detector.cpp
+ * \brief  iR[h́ǰo
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "chord_detector.h"
+
+//==============================================================================
+// 
+//==============================================================================
+void ChordDetector::Clear() {
+    m_masks.clear();
+    m_windowIndex.clear();
+    m_windowCount = 0;
+    Reset();
+}
+
+void ChordDetector::Reset() {
+    for (uint64_t& time : m_pressTime) {
+        time = 0;
+    }
+    m_prevButtons = 0;
+    m_events.clear();
+}
+
+//==============================================================================
+// R[ho^
+//==============================================================================
+int ChordDetector::AddChord(uint32_t buttons, uint32_t windowUs) {
+    buttons &= (1u << BUTTON_COUNT) - 1;
+    if (buttons == 0) {
+        return -1;
+    }
+
+    int window = 0;
+    while (window < m_windowCount && m_windows[window] != windowUs) {
+        window++;
+    }
+    if (window == m_windowCount) {
+        if (m_windowCount == MAX_WINDOWS) {
+            return -1;
+        }
+        m_windows[m_windowCount++] = windowUs;
+    }
+
+    m_masks.push_back(buttons);
+    m_windowIndex.push_back(static_cast<uint8_t>(window));
+    return static_cast<int>(m_masks.size()) - 1;
+}
+
+//==============================================================================
+// 
+//==============================================================================
+int ChordDetector::Update(uint32_t buttons, uint64_t timeUs) {
+    m_events.clear();
+
+    uint32_t pressed = buttons & ~m_prevButtons;
+    m_prevButtons = buttons;
+
+    // uԂȂΐVR[h͂Ȃ
+    if (pressed == 0) {
+        return 0;
+    }
+
+    for (int bit = 0; bit < BUTTON_COUNT; bit++) {
+        if (pressed & (1u << bit)) {
+            m_pressTime[bit] = timeUs;
+        }
+    }
+    return Evaluate(buttons, pressed, timeUs, m_pressTime);
+}
+
+int ChordDetector::Update(const ButtonTracker& tracker) {
+    m_events.clear();
+    m_prevButtons = tracker.GetButtons();
+
+    uint32_t pressed = tracker.GetPressedMask();
+    if (pressed == 0) {
+        return 0;
+    }
+
+    uint64_t pressTime[BUTTON_COUNT];
+    for (int bit = 0; bit < BUTTON_COUNT; bit++) {
+        pressTime[bit] = tracker.GetPressTimeAt(bit);
+    }
+    return Evaluate(tracker.GetButtons(), pressed, tracker.GetUpdateTime(), pressTime);
+}
+
+int ChordDetector::Evaluate(uint32_t buttons, uint32_t pressed, uint64_t timeUs, const uint64_t* pPressTime) {
+    // tԂƂɁutԓɉčĂ{^v
+    uint32_t ready[MAX_WINDOWS];
+    for (int w = 0; w < m_windowCount; w++) {
+        uint32_t mask = 0;
+        for (int bit = 0; bit < BUTTON_COUNT; bit++) {
+            if (timeUs - pPressTime[bit] <= m_windows[w]) {
+                mask |= 1u << bit;
+            }
+        }
+        ready[w] = mask & buttons;
+    }
+
+    // \{^̂ǂꂩāA\{^ׂĎtԓɑĂΐ
+    const uint32_t* pMasks = m_masks.data();
+    const uint8_t* pWindows = m_windowIndex.data();
+    int count = static_cast<int>(m_masks.size());
+    for (int i = 0; i < count; i++) {
+        uint32_t mask = pMasks[i];
+        if ((mask & pressed) != 0 && (mask & ~ready[pWindows[i]]) == 0) {
+            m_events.push_back({ i, timeUs });
+        }
+    }
+    return static_cast<int>(m_events.size());
+}
+
+//==============================================================================
+// 
+//==============================================================================
+bool ChordDetector::IsTriggered(int chordId) const {
+    for (const ChordEvent& event : m_events) {
+        if (event.chordId == chordId) {
+            return true;
+        }
+    }
+    return false;
+}
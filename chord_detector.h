@@ -0,0 +1,84 @@
+/*****************************************************************//**
+ * \file   chord_detector.h
+ * \brief  iR[h́ǰo
+ *
+ * uL1+R1vuAB3t[ȓɁv̂悤ȓA{^Ƃ
+ * Ōɉ画肷BIsTrigger_*gݍ킹1t[ꂽ
+ * 肱ڂAł͎tԓɑSĂΐB
+ *
+ * ̓rbg}XNōsBuԂ̃{^t[A
+ * tԂƂɁutԓɉčĂ{^ṽ}XNA
+ * eR[h́u\{^̂ǂꂩvu\{^ׂẴ}XNɓĂv
+ * 2ANDrŔ肷BR[hSĂ1t[ׂ͂̕قڕςȂB
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "button_tracker.h"
+
+//==============================================================================
+// R[h
+//==============================================================================
+struct ChordEvent {
+    int chordId;            // AddChord()̖߂l
+    uint64_t timeUs;        // Ō̍\{^
+};
+
+//==============================================================================
+// oNX
+//==============================================================================
+class ChordDetector {
+public:
+    // 肷{^̃rbgiPAD_BUTTON_*16rbg{fW^L2/R2j
+    static constexpr int BUTTON_COUNT = ButtonTracker::BUTTON_COUNT;
+    // tԂ̎ނ̏itԂ̃R[h͂܂Ƃ߂Ĕ肷j
+    static constexpr int MAX_WINDOWS = 8;
+
+    ChordDetector() { Clear(); }
+
+    // R[hׂč폜ĉY
+    void Clear();
+    // YiڑƂȂǁj
+    void Reset();
+
+    // R[ho^IDԂi{^EtԂ̎ނȂ-1j
+    // buttonsGameController::GetButtons()Ɠrbgizuϊj
+    int AddChord(uint32_t buttons, uint32_t windowUs);
+    int GetChordCount() const { return static_cast<int>(m_masks.size()); }
+    uint32_t GetChordButtons(int chordId) const { return m_masks[chordId]; }
+
+    // 1t[̃{^ԂnĔ肷iR[h̐Ԃj
+    int Update(uint32_t buttons, uint64_t timeUs);
+    // ButtonTracker̉̂܂܎gĔ肷iRg[[̍XVɌĂԁj
+    int Update(const ButtonTracker& tracker);
+
+    // ߂Update()ŐR[hiIDj
+    int GetEventCount() const { return static_cast<int>(m_events.size()); }
+    const ChordEvent& GetEvent(int index) const { return m_events[index]; }
+    bool IsTriggered(int chordId) const;
+
+private:
+    // ̔
+    int Evaluate(uint32_t buttons, uint32_t pressed, uint64_t timeUs, const uint64_t* pPressTime);
+
+    // R[hi胋[vAr߂悤z𕪂j
+    std::vector<uint32_t> m_masks;
+    std::vector<uint8_t> m_windowIndex;
+
+    // tԂ̎
+    uint32_t m_windows[MAX_WINDOWS];
+    int m_windowCount;
+
+    // {^Ƃ̍Ōɉ
+    uint64_t m_pressTime[BUTTON_COUNT];
+    uint32_t m_prevButtons;
+
+    std::vector<ChordEvent> m_events;
+};
+
+// t[tԂit[Ԋu̗hŔt[j
+inline uint32_t ChordWindowFromFrames(int frames, int framesPerSecond = 60) {
+    return static_cast<uint32_t>((frames * 2 + 1) * 1000000LL / (framesPerSecond * 2));
+}
@@ -0,0 +1,94 @@
+/*****************************************************************//**
+ * \file   console_frame.cpp
+ * \brief  ςoR\[
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "console_frame.h"
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+//==============================================================================
+// 
+//==============================================================================
+ConsoleFrame::ConsoleFrame() {
+    Clear();
+    memset(m_front, ' ', sizeof(m_front));
+}
+
+//==============================================================================
+// gݗ
+//==============================================================================
+void ConsoleFrame::Clear() {
+    memset(m_back, ' ', sizeof(m_back));
+}
+
+void ConsoleFrame::Print(int x, int y, const char* pText, int width) {
+    if (y < 0 || y >= HEIGHT || x < 0 || x >= WIDTH) {
+        return;
+    }
+    int end = (width > 0 && x + width < WIDTH) ? x + width : WIDTH;
+    for (int i = x; i < end && *pText != '\0'; i++) {
+        m_back[y][i] = *pText++;
+    }
+}
+
+void ConsoleFrame::Printf(int x, int y, int width, const char* pFormat, ...) {
+    char text[WIDTH + 1];
+    va_list args;
+    va_start(args, pFormat);
+    vsnprintf_s(text, sizeof(text), _TRUNCATE, pFormat, args);
+    va_end(args);
+    Print(x, y, text, width);
+}
+
+void ConsoleFrame::Fill(int x, int y, int width, int height, char ch) {
+    for (int row = y; row < y + height && row < HEIGHT; row++) {
+        if (row < 0) {
+            continue;
+        }
+        for (int col = x; col < x + width && col < WIDTH; col++) {
+            if (col >= 0) {
+                m_back[row][col] = ch;
+            }
+        }
+    }
+}
+
+//==============================================================================
+// o
+//==============================================================================
+int ConsoleFrame::Present(HANDLE hConsole) {
+    m_presentCount++;
+    int written = 0;
+
+    for (int y = 0; y < HEIGHT; y++) {
+        // s̒ŕςŏƍŌ̊̕Ԃ1ŏ
+        int first = 0;
+        int last = WIDTH - 1;
+        if (m_isValid) {
+            while (first < WIDTH && m_back[y][first] == m_front[y][first]) {
+                first++;
+            }
+            if (first == WIDTH) {
+                continue;
+            }
+            while (m_back[y][last] == m_front[y][last]) {
+                last--;
+            }
+        }
+
+        int length = last - first + 1;
+        COORD coord = { static_cast<SHORT>(first), static_cast<SHORT>(y) };
+        SetConsoleCursorPosition(hConsole, coord);
+        DWORD count = 0;
+        WriteConsoleA(hConsole, &m_back[y][first], static_cast<DWORD>(length), &count, nullptr);
+        memcpy(&m_front[y][first], &m_back[y][first], length);
+        written += length;
+    }
+
+    m_isValid = true;
+    m_writtenChars += written;
+    return written;
+}
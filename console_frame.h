@@ -0,0 +1,51 @@
+/*****************************************************************//**
+ * \file   console_frame.h
+ * \brief  ςoR\[
+ *
+ * 80x25̕obt@1ʕgݗāAPresent()őO񏑂oe
+ * ׂāAςs̕ς͈͂R\[֏B
+ * ~܂Ăpbh̕\1Ȃ̂ŁA4l𖈃t[
+ * gݗĂĂAR\[ւ݂͓̏Ă镔̕ɂȂB
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include <windows.h>
+#include <cstdint>
+
+//==============================================================================
+// R\[ʃNX
+//==============================================================================
+class ConsoleFrame {
+public:
+    static constexpr int WIDTH = 80;
+    static constexpr int HEIGHT = 25;
+
+    ConsoleFrame();
+
+    // gݗĒ̉ʂ󔒂Ŗ߂
+    void Clear();
+    // wʒu珑iʊOEwidth𒴂镪͐؂̂āAwidth0Ȃs܂Łj
+    void Print(int x, int y, const char* pText, int width = 0);
+    // printf`ŏ
+    void Printf(int x, int y, int width, const char* pFormat, ...);
+    // w͈͂󔒂Ŗ߂
+    void Fill(int x, int y, int width, int height, char ch = ' ');
+
+    // OƂ̍oi߂l͏j
+    int Present(HANDLE hConsole);
+    // Present()őŜiʂ𑼂̏o͂ŏ㏑Ƃj
+    void Invalidate() { m_isValid = false; }
+
+    // viĂ邩̊mFpj
+    uint64_t GetPresentCount() const { return m_presentCount; }
+    uint64_t GetWrittenChars() const { return m_writtenChars; }
+
+private:
+    char m_back[HEIGHT][WIDTH];     // gݗĒ
+    char m_front[HEIGHT][WIDTH];    // R\[ɏoĂe
+    bool m_isValid = false;
+
+    uint64_t m_presentCount = 0;
+    uint64_t m_writtenChars = 0;
+};
@@ -0,0 +1,168 @@
+/*****************************************************************//**
+ * \file   contention_benchmark.cpp
+ * \brief  pbhԂ̎󂯓nł̃LbVC̎荇̔r
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "contention_benchmark.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "pad_state_board.h"
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // pbhƓǂݎ̐iǂݎi̓pbhiǂށA0Ԃpbhj
+    constexpr int PAD_COUNT = PadStateBoard::MAX_PADS;
+    constexpr int READER_COUNT = PAD_COUNT;
+    // 1zǔv
+    constexpr int RUN_MILLISECONDS = 500;
+
+    //==========================================================================
+    // l߂zuipbhƂ̋LƏ̋L^ׂ荇Aǂݎ̉񐔂ׂ荇j
+    //==========================================================================
+    struct PackedPad {
+        PadStateCell cell;
+        CompactGamepadState last;
+        uint64_t submitCount = 0;
+        uint64_t publishCount = 0;
+    };
+
+    struct PackedLayout {
+        PackedPad pads[PAD_COUNT];
+        uint32_t lastSequence[READER_COUNT] = {};
+        uint64_t readCount[READER_COUNT] = {};
+
+        void Submit(int pad, const CompactGamepadState& state, uint64_t timeUs) {
+            PackedPad& packed = pads[pad];
+            packed.submitCount++;
+            if (packed.publishCount > 0 && memcmp(&packed.last, &state, sizeof(CompactGamepadState)) == 0) {
+                return;
+            }
+            packed.last = state;
+            packed.publishCount++;
+            packed.cell.Publish(state, timeUs);
+        }
+
+        void Read(int reader, int pad) {
+            CompactGamepadState state;
+            lastSequence[reader] = pads[pad].cell.Read(&state, nullptr);
+            readCount[reader]++;
+        }
+
+        uint64_t GetReadCount(int reader) const { return readCount[reader]; }
+    };
+
+    //==========================================================================
+    // LbVCŕzuiPadStateBoard{ǂݎ育ƂPadStateReaderj
+    //==========================================================================
+    struct PaddedLayout {
+        PadStateBoard board;
+        PadStateReader readers[READER_COUNT];
+
+        PaddedLayout() {
+            for (PadStateReader& reader : readers) {
+                reader.SetBoard(&board);
+            }
+        }
+
+        void Submit(int pad, const CompactGamepadState& state, uint64_t timeUs) {
+            board.Submit(pad, state, timeUs);
+        }
+
+        void Read(int reader, int pad) {
+            CompactGamepadState state;
+            readers[reader].Read(pad, &state);
+        }
+
+        uint64_t GetReadCount(int reader) const { return readers[reader].GetReadCount(); }
+    };
+
+    struct ContentionResult {
+        double submitsPerUs;
+        double readsPerUs[READER_COUNT];
+    };
+
+    //==========================================================================
+    // v
+    //==========================================================================
+    template<typename Layout>
+    ContentionResult Measure(Layout* pLayout) {
+        std::atomic<bool> isRunning{ true };
+        std::atomic<int> readyCount{ 0 };
+
+        std::vector<std::thread> threads;
+        for (int r = 0; r < READER_COUNT; r++) {
+            threads.emplace_back([pLayout, r, &isRunning, &readyCount]() {
+                readyCount.fetch_add(1);
+                while (isRunning.load(std::memory_order_relaxed)) {
+                    pLayout->Read(r, r);
+                }
+            });
+        }
+        while (readyCount.load() < READER_COUNT) {
+            std::this_thread::yield();
+        }
+
+        // ͂̃XbhiTv[jASpbho0Ԃω
+        CompactGamepadState moving;
+        CompactGamepadState idle;
+        uint64_t submits = 0;
+        auto begin = std::chrono::steady_clock::now();
+        auto end = begin + std::chrono::milliseconds(RUN_MILLISECONDS);
+        for (uint64_t frame = 0; ; frame++) {
+            moving.leftStickX = static_cast<int16_t>(frame);
+            pLayout->Submit(0, moving, frame);
+            for (int pad = 1; pad < PAD_COUNT; pad++) {
+                pLayout->Submit(pad, idle, frame);
+            }
+            submits += PAD_COUNT;
+            if ((frame & 1023) == 0 && std::chrono::steady_clock::now() >= end) {
+                break;
+            }
+        }
+        auto finish = std::chrono::steady_clock::now();
+        isRunning.store(false);
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        double elapsedUs = std::chrono::duration<double, std::micro>(finish - begin).count();
+        ContentionResult result;
+        result.submitsPerUs = submits / elapsedUs;
+        for (int r = 0; r < READER_COUNT; r++) {
+            result.readsPerUs[r] = pLayout->GetReadCount(r) / elapsedUs;
+        }
+        return result;
+    }
+
+    void PrintResult(const char* pName, const ContentionResult& result) {
+        printf(" %-8s | %10.1f |", pName, result.submitsPerUs);
+        for (int r = 0; r < READER_COUNT; r++) {
+            printf(" %8.1f", result.readsPerUs[r]);
+        }
+        printf("\n");
+    }
+}
+
+//==============================================================================
+// x`}[Ns
+//==============================================================================
+int RunContentionBenchmark() {
+    // zuƂ̑̂܂܌ʂɏo悤AÓÏɒu
+    static PackedLayout s_packed;
+    static PaddedLayout s_padded;
+
+    printf(" 1 writer (pad 0 moving, pads 1-%d idle), %d readers (reader i reads pad i), %u hardware threads\n",
+        PAD_COUNT - 1, READER_COUNT, std::thread::hardware_concurrency());
+    printf(" layout   | submits/us | reads/us per reader (pad 0 .. %d)\n", PAD_COUNT - 1);
+    printf("----------+------------+------------------------------------\n");
+    PrintResult("packed", Measure(&s_packed));
+    PrintResult("padded", Measure(&s_padded));
+    return 0;
+}
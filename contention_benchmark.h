@@ -0,0 +1,15 @@
+/*****************************************************************//**
+ * \file   contention_benchmark.h
+ * \brief  pbhԂ̎󂯓nł̃LbVC̎荇̔r
+ *
+ * 1Xbh1ڂ̃pbh𓮂AǂݎXbh
+ * ꂼʂ̃pbhǂݑBl߂ĕׂzuiJς݂̏ԁE
+ * ̋L^Eǂݎ̉񐔂sɍjPadStateBoard̔zuŁA
+ * 莞ԓ̓ǂݎ񐔂ׂB~܂Ăpbh̓ǂݎقǍoB
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+
+// x`}[NsČʂ\i0Ԃj
+int RunContentionBenchmark();
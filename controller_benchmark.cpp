@@ -0,0 +1,253 @@
+/*****************************************************************//**
+ * \file   controller_benchmark.cpp
+ * \brief  |V[RpCɌ߂BasicControllerƎs؂ւł̑xr
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#define NOMINMAX
+#include "controller_benchmark.h"
+#include <chrono>
+#include <cstdio>
+#include "game_controller_impl.h"
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // ͂̐i2ׂ̂jƁA1vUpdate()
+    constexpr int SCRIPT_STATES = 4096;
+    constexpr int UPDATE_COUNT = 5000000;
+
+    // rp̊̕
+    constexpr int SMOOTHING_PERCENT = 50;
+
+    //==========================================================================
+    // ́iXeBbN񂵂Ȃ玞X{^j
+    //==========================================================================
+    XINPUT_STATE s_script[SCRIPT_STATES];
+    unsigned int s_scriptCursor = 0;
+    ULONGLONG s_clock = 0;
+
+    void BuildScript() {
+        unsigned int seed = 12345;
+        for (int i = 0; i < SCRIPT_STATES; i++) {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+
+            float angle = i * (6.2831853f / 256.0f);
+            float radius = (i & 1024) ? 30000.0f : 4000.0f;
+            XINPUT_STATE& state = s_script[i];
+            ZeroMemory(&state, sizeof(XINPUT_STATE));
+            state.Gamepad.sThumbLX = static_cast<SHORT>(std::cos(angle) * radius);
+            state.Gamepad.sThumbLY = static_cast<SHORT>(std::sin(angle) * radius);
+            state.Gamepad.sThumbRX = static_cast<SHORT>((seed & 0xFFFF) - 0x8000);
+            state.Gamepad.sThumbRY = static_cast<SHORT>(((seed >> 16) & 0xFFFF) - 0x8000);
+            state.Gamepad.bLeftTrigger = static_cast<BYTE>(seed >> 8);
+            state.Gamepad.wButtons = static_cast<WORD>((seed & 7) == 0 ? seed >> 16 : 0);
+        }
+    }
+
+    // 1msi߂iQueryPerformanceCounter̃RXgvɓȂj
+    ULONGLONG ScriptClock() {
+        return s_clock += 1000;
+    }
+
+    //==========================================================================
+    // ͂ԂobNGh
+    //==========================================================================
+    struct ScriptBackend : NullBackend {
+        static DWORD WINAPI GetState(DWORD, XINPUT_STATE* pState) {
+            *pState = s_script[s_scriptCursor++ & (SCRIPT_STATES - 1)];
+            return ERROR_SUCCESS;
+        }
+    };
+
+    //==========================================================================
+    // sɐ؂ւŁirΏہj
+    //==========================================================================
+    class DeadzoneBase {
+    public:
+        virtual ~DeadzoneBase() = default;
+        virtual void DecodeSticks(const RawGamepad& raw, const GamepadCalibration& calibration, GamepadState* pState) const = 0;
+    };
+
+    class FilterBase {
+    public:
+        virtual ~FilterBase() = default;
+        virtual void Apply(GamepadState* pState, const GamepadState& prev) const = 0;
+    };
+
+    template<typename Policy>
+    class RuntimeDeadzone : public DeadzoneBase {
+    public:
+        void DecodeSticks(const RawGamepad& raw, const GamepadCalibration& calibration, GamepadState* pState) const override {
+            Policy::DecodeSticks(raw, calibration, pState);
+        }
+    };
+
+    template<typename Policy>
+    class RuntimeFilter : public FilterBase {
+    public:
+        void Apply(GamepadState* pState, const GamepadState& prev) const override {
+            Policy::Apply(pState, prev);
+        }
+    };
+
+    // BasicControllerUpdate()Ɠ菇A֐|C^Ɖz֐ōs
+    // i{^zu̕ϊEԁEL[s[gEXeBbN܂Ŋ܂߁Ar𓯂dʂɂj
+    class RuntimeController {
+    public:
+        RuntimeController(StateSourceFunc pSource, const DeadzoneBase* pDeadzone, const FilterBase* pFilter)
+            : m_pSource(pSource), m_pDeadzone(pDeadzone), m_pFilter(pFilter),
+            m_pButtonLayout(&::GetButtonLayout(BUTTON_LAYOUT_XBOX)) {}
+
+        void Update() {
+            m_updateTime = ScriptClock();
+            UpdateState();
+            const GamepadState& current = m_states[m_currentIndex];
+            uint32_t buttons = m_buttons[m_currentIndex];
+            m_buttonTracker.Update(buttons, m_updateTime);
+            if (current.connected) {
+                m_keyRepeat.Update(buttons, current.leftStickX, current.leftStickY, m_updateTime);
+                m_leftDirection.Update(current.leftStickX, current.leftStickY);
+                m_rightDirection.Update(current.rightStickX, current.rightStickY);
+            } else {
+                m_keyRepeat.Update(0, 0.0f, 0.0f, m_updateTime);
+                m_leftDirection.Update(0.0f, 0.0f);
+                m_rightDirection.Update(0.0f, 0.0f);
+            }
+        }
+
+        const GamepadState& GetCurrentState() const { return m_states[m_currentIndex]; }
+
+    private:
+        void UpdateState() {
+            m_currentIndex ^= 1;
+            GamepadState& current = m_states[m_currentIndex];
+            const GamepadState& prev = m_states[m_currentIndex ^ 1];
+
+            // ڑ̍ĒT̊ԈiBasicController::IsProbeDue()̎ɓj
+            if (!prev.connected && m_updateTime < m_nextProbeTime) {
+                SetDisconnected();
+                return;
+            }
+
+            XINPUT_STATE state;
+            if (m_pSource(0, &state) != ERROR_SUCCESS) {
+                m_nextProbeTime = m_updateTime + controller_detail::IDLE_PROBE_FIRST_US;
+                SetDisconnected();
+                return;
+            }
+
+            RawGamepad raw;
+            raw.buttons = state.Gamepad.wButtons;
+            raw.leftTrigger = state.Gamepad.bLeftTrigger;
+            raw.rightTrigger = state.Gamepad.bRightTrigger;
+            raw.thumbLX = state.Gamepad.sThumbLX;
+            raw.thumbLY = state.Gamepad.sThumbLY;
+            raw.thumbRX = state.Gamepad.sThumbRX;
+            raw.thumbRY = state.Gamepad.sThumbRY;
+
+            RawGamepad remapped = raw;
+            remapped.buttons = m_pButtonLayout->remap.Apply(raw.buttons);
+            DecodeGamepadButtons(remapped, m_calibration, &current);
+            m_pDeadzone->DecodeSticks(raw, m_calibration, &current);
+            m_pFilter->Apply(&current, prev);
+
+            uint32_t buttons = remapped.buttons;
+            if (current.buttonL2) buttons |= PAD_BUTTON_LEFT_TRIGGER;
+            if (current.buttonR2) buttons |= PAD_BUTTON_RIGHT_TRIGGER;
+            m_buttons[m_currentIndex] = buttons;
+        }
+
+        void SetDisconnected() {
+            m_states[m_currentIndex] = m_states[m_currentIndex ^ 1];
+            m_states[m_currentIndex].connected = false;
+            m_buttons[m_currentIndex] = 0;
+        }
+
+        StateSourceFunc m_pSource;
+        const DeadzoneBase* m_pDeadzone;
+        const FilterBase* m_pFilter;
+        const ButtonLayout* m_pButtonLayout;
+        GamepadCalibration m_calibration;
+        GamepadState m_states[2];
+        uint32_t m_buttons[2] = {};
+        int m_currentIndex = 0;
+        ULONGLONG m_updateTime = 0;
+        ULONGLONG m_nextProbeTime = 0;
+        ButtonTracker m_buttonTracker;
+        KeyRepeat m_keyRepeat;
+        StickQuantizer m_leftDirection;
+        StickQuantizer m_rightDirection;
+    };
+
+    //==========================================================================
+    // v
+    //==========================================================================
+    // œKŏȂ悤ʂł
+    volatile float s_sink = 0.0f;
+
+    template<typename Controller>
+    double MeasureController() {
+        Controller::SetClockSource(ScriptClock);
+        Controller::Initialize();
+        s_scriptCursor = 0;
+
+        float sum = 0.0f;
+        auto begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < UPDATE_COUNT; i++) {
+            Controller::Update();
+            sum += Controller::GetLeftStickX() + Controller::GetRightStickY();
+        }
+        auto end = std::chrono::steady_clock::now();
+        s_sink = s_sink + sum;
+
+        Controller::Finalize();
+        Controller::SetClockSource(nullptr);
+        return std::chrono::duration<double, std::nano>(end - begin).count() / UPDATE_COUNT;
+    }
+
+    double MeasureRuntime(const DeadzoneBase& deadzone, const FilterBase& filter) {
+        RuntimeController controller(ScriptBackend::GetState, &deadzone, &filter);
+        s_scriptCursor = 0;
+
+        float sum = 0.0f;
+        auto begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < UPDATE_COUNT; i++) {
+            controller.Update();
+            sum += controller.GetCurrentState().leftStickX + controller.GetCurrentState().rightStickY;
+        }
+        auto end = std::chrono::steady_clock::now();
+        s_sink = s_sink + sum;
+
+        return std::chrono::duration<double, std::nano>(end - begin).count() / UPDATE_COUNT;
+    }
+
+    typedef BasicController<ScriptBackend, AxialDeadzone, NoFilter> AxialController;
+    typedef BasicController<ScriptBackend, RadialDeadzone, NoFilter> RadialController;
+    typedef BasicController<ScriptBackend, RadialDeadzone, SmoothingFilter<SMOOTHING_PERCENT>> SmoothedController;
+}
+
+//==============================================================================
+// x`}[Ns
+//==============================================================================
+int RunControllerBenchmark() {
+    BuildScript();
+
+    RuntimeDeadzone<AxialDeadzone> axial;
+    RuntimeDeadzone<RadialDeadzone> radial;
+    RuntimeFilter<NoFilter> noFilter;
+    RuntimeFilter<SmoothingFilter<SMOOTHING_PERCENT>> smoothing;
+
+    printf(" configuration                 | compile-time | runtime  (ns / Update)\n");
+    printf("-------------------------------+--------------+---------\n");
+    printf(" axial deadzone, no filter     | %12.2f | %8.2f\n",
+        MeasureController<AxialController>(), MeasureRuntime(axial, noFilter));
+    printf(" radial deadzone, no filter    | %12.2f | %8.2f\n",
+        MeasureController<RadialController>(), MeasureRuntime(radial, noFilter));
+    printf(" radial deadzone, smoothing    | %12.2f | %8.2f\n",
+        MeasureController<SmoothedController>(), MeasureRuntime(radial, smoothing));
+    return 0;
+}
@@ -0,0 +1,13 @@
+/*****************************************************************//**
+ * \file   controller_benchmark.h
+ * \brief  |V[RpCɌ߂BasicControllerƎs؂ւł̑xr
+ *
+ * ǂ͂ǂ݁AUpdate()1񂠂̎Ԃ𑪂B
+ * s؂ւł̓fbh][EtB^[z֐ŌĂԁB
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+
+// x`}[NsČʂ\i0Ԃj
+int RunControllerBenchmark();
@@ -0,0 +1,156 @@
+/*****************************************************************//**
+ * \file   controller_policies.h
+ * \brief  BasicControllerɑgݍ킹|V[iobNGhEfbh][EtB^[j
+ *
+ * |V[ׂ͂ĐÓI֐̍\̂ŁAev[gƂēnB
+ * Ăяo悪RpCɌ܂̂ŁAUpdate()͉̒z֐
+ * ֐|C^ʂ炸ɃCCWJB
+ *
+ *   Backend        : GetState / SetState / GetBatteryInformation /
+ *                    GetCapabilities / GetKeystroke / GetAudioDeviceIds
+ *   DeadzonePolicy : DecodeSticks(raw, calibration, pState)
+ *   FilterPolicy   : Apply(pState, prev)
+ *
+ * XeBbN̒l|V[͍ŌpState->InvalidatePolar()ĂԁB
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include <windows.h>
+#include <Xinput.h>
+#include <cmath>
+#include "gamepad_state.h"
+
+#pragma comment(lib, "xinput.lib")
+
+//==============================================================================
+// obNGh: XInput
+//==============================================================================
+struct XInputBackend {
+    static DWORD WINAPI GetState(DWORD userIndex, XINPUT_STATE* pState) {
+        return XInputGetState(userIndex, pState);
+    }
+    static DWORD SetState(DWORD userIndex, XINPUT_VIBRATION* pVibration) {
+        return XInputSetState(userIndex, pVibration);
+    }
+    static DWORD GetBatteryInformation(DWORD userIndex, BYTE devType, XINPUT_BATTERY_INFORMATION* pInfo) {
+        return XInputGetBatteryInformation(userIndex, devType, pInfo);
+    }
+    static DWORD GetCapabilities(DWORD userIndex, DWORD flags, XINPUT_CAPABILITIES* pCaps) {
+        return XInputGetCapabilities(userIndex, flags, pCaps);
+    }
+    static DWORD GetKeystroke(DWORD userIndex, XINPUT_KEYSTROKE* pKeystroke) {
+        return XInputGetKeystroke(userIndex, 0, pKeystroke);
+    }
+    static DWORD GetAudioDeviceIds(DWORD userIndex, LPWSTR pRenderDeviceId, UINT* pRenderCount,
+        LPWSTR pCaptureDeviceId, UINT* pCaptureCount) {
+        return XInputGetAudioDeviceIds(userIndex, pRenderDeviceId, pRenderCount, pCaptureDeviceId, pCaptureCount);
+    }
+};
+
+//==============================================================================
+// obNGh: foCXȂiGetStateւeXgEx`}[Np̓yj
+//==============================================================================
+struct NullBackend {
+    static DWORD WINAPI GetState(DWORD, XINPUT_STATE*) {
+        return ERROR_DEVICE_NOT_CONNECTED;
+    }
+    static DWORD SetState(DWORD, XINPUT_VIBRATION*) {
+        return ERROR_DEVICE_NOT_CONNECTED;
+    }
+    static DWORD GetBatteryInformation(DWORD, BYTE, XINPUT_BATTERY_INFORMATION*) {
+        return ERROR_DEVICE_NOT_CONNECTED;
+    }
+    static DWORD GetCapabilities(DWORD, DWORD, XINPUT_CAPABILITIES*) {
+        return ERROR_DEVICE_NOT_CONNECTED;
+    }
+    static DWORD GetKeystroke(DWORD, XINPUT_KEYSTROKE*) {
+        return ERROR_DEVICE_NOT_CONNECTED;
+    }
+    static DWORD GetAudioDeviceIds(DWORD, LPWSTR, UINT*, LPWSTR, UINT*) {
+        return ERROR_DEVICE_NOT_CONNECTED;
+    }
+};
+
+//==============================================================================
+// fbh][: ƁiXInput̊Ɠlpfbh][j
+//==============================================================================
+struct AxialDeadzone {
+    static void DecodeSticks(const RawGamepad& raw, const GamepadCalibration& calibration, GamepadState* pState) {
+        DecodeAxialSticks(raw, calibration, pState);
+    }
+};
+
+//==============================================================================
+// fbh][: ~`i|ۂ܂ܑ傫Ŕ肷j
+//==============================================================================
+struct RadialDeadzone {
+    static void DecodeSticks(const RawGamepad& raw, const GamepadCalibration& calibration, GamepadState* pState) {
+        DecodeStick(raw.thumbLX, raw.thumbLY, calibration.leftStick, calibration.extraDeadzone,
+            &pState->leftStickX, &pState->leftStickY);
+        DecodeStick(raw.thumbRX, raw.thumbRY, calibration.rightStick, calibration.extraDeadzone,
+            &pState->rightStickX, &pState->rightStickY);
+        pState->InvalidatePolar();
+    }
+
+private:
+    static void DecodeStick(int16_t rawX, int16_t rawY, const StickCalibration& stick, float extra,
+        float* pX, float* pY) {
+        constexpr float MAX_VALUE = 32767.0f;
+        float x = static_cast<float>(rawX - stick.centerX);
+        float y = static_cast<float>(rawY - stick.centerY);
+        float magnitude = std::sqrt(x * x + y * y);
+
+        // Õfbh][܂߂0 ~ 1
+        float deadzone = static_cast<float>(stick.deadzone);
+        float normalized = (magnitude - deadzone) / (MAX_VALUE - deadzone);
+        normalized = (normalized - extra) / (1.0f - extra);
+        if (normalized <= 0.0f) {
+            *pX = 0.0f;
+            *pY = 0.0f;
+            return;
+        }
+        if (normalized > 1.0f) normalized = 1.0f;
+
+        // Y͏𕉂ɂiƂ̃fR[hƓj
+        float scale = normalized / magnitude;
+        *pX = x * scale;
+        *pY = -y * scale;
+    }
+};
+
+//==============================================================================
+// tB^[: Ȃ
+//==============================================================================
+struct NoFilter {
+    static void Apply(GamepadState*, const GamepadState&) {}
+};
+
+//==============================================================================
+// tB^[: XeBbN̎wiWEIGHT_PERCENT̒l̊j
+//==============================================================================
+template<int WEIGHT_PERCENT>
+struct SmoothingFilter {
+    static_assert(WEIGHT_PERCENT > 0 && WEIGHT_PERCENT <= 100, "WEIGHT_PERCENT must be 1..100");
+
+    static void Apply(GamepadState* pState, const GamepadState& prev) {
+        // ڑ͑O̒lĂɂȂȂ̂ł̂܂
+        if (!prev.connected) {
+            return;
+        }
+        pState->leftStickX = Smooth(prev.leftStickX, pState->leftStickX);
+        pState->leftStickY = Smooth(prev.leftStickY, pState->leftStickY);
+        pState->rightStickX = Smooth(prev.rightStickX, pState->rightStickX);
+        pState->rightStickY = Smooth(prev.rightStickY, pState->rightStickY);
+        pState->InvalidatePolar();
+    }
+
+private:
+    static float Smooth(float prev, float current) {
+        constexpr float WEIGHT = WEIGHT_PERCENT / 100.0f;
+        // ̒l1iK菬Ȃ0ɑi0֑Q߂Ɣ񐳋KɂȂĒxj
+        constexpr float SNAP = 1.0f / 32768.0f;
+        float value = prev + (current - prev) * WEIGHT;
+        return (value > -SNAP && value < SNAP) ? 0.0f : value;
+    }
+};
@@ -0,0 +1,275 @@
+/*****************************************************************//**
+ * \file   deadzone_tuner.cpp
+ * \brief  Î~̃XeBbN͂fbh][𐄒肷
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "deadzone_tuner.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // Î~̑̒
+    constexpr uint64_t WINDOW_US = 250000;
+
+    // ̒łȏ㓮ΐGĂƂ݂Ȃ
+    constexpr int32_t REST_RANGE_LIMIT = 4096;
+    // ̕ς0炱ȏ㗣ĂΓ|܂܎ĂƂ݂Ȃ
+    constexpr int32_t REST_OFFSET_LIMIT = 12000;
+    // gK[ȏĂΐGĂƂ݂Ȃ
+    constexpr int REST_TRIGGER_LIMIT = 64;
+
+    // mCYɑ΂]Ti~5/4{256j
+    constexpr int32_t SAFETY_RATIO_NUM = 5;
+    constexpr int32_t SAFETY_RATIO_DEN = 4;
+    constexpr int32_t SAFETY_MARGIN = 256;
+
+    // fbh][͈̔
+    constexpr int32_t MIN_DEADZONE = 1024;
+    constexpr int32_t MAX_DEADZONE = 16384;
+
+    // gK[臒liÎ~̍ől{]Tj
+    constexpr int TRIGGER_MARGIN = 8;
+    constexpr int MIN_TRIGGER_THRESHOLD = 4;
+    constexpr int MAX_TRIGGER_THRESHOLD = 64;
+
+    // Nv֐iOj
+    template<typename T>
+    T Clamp(T value, T minVal, T maxVal) {
+        if (value < minVal) return minVal;
+        if (value > maxVal) return maxVal;
+        return value;
+    }
+
+    // őliOj
+    template<typename T>
+    T Max(T a, T b) {
+        return (a > b) ? a : b;
+    }
+
+    // ̒lWvɉ
+    inline void AddAxis(int32_t value, int64_t* pSum, int64_t* pSumSq, int32_t* pMin, int32_t* pMax) {
+        *pSum += value;
+        *pSumSq += static_cast<int64_t>(value) * value;
+        if (value < *pMin) *pMin = value;
+        if (value > *pMax) *pMax = value;
+    }
+}
+
+//==============================================================================
+// 
+//==============================================================================
+void DeadzoneTuner::Reset() {
+    ClearWindow(&m_window);
+    ClearWindow(&m_total);
+    m_windowStart = 0;
+    m_rejectedWindows = 0;
+}
+
+void DeadzoneTuner::ClearWindow(WindowStats* pWindow) {
+    for (AxisStats& axis : pWindow->axes) {
+        axis.sum = 0;
+        axis.sumSq = 0;
+        axis.min = INT32_MAX;
+        axis.max = INT32_MIN;
+    }
+    pWindow->triggerMax[0] = 0;
+    pWindow->triggerMax[1] = 0;
+    pWindow->count = 0;
+    pWindow->touched = false;
+}
+
+//==============================================================================
+// Tvǉ
+//==============================================================================
+void DeadzoneTuner::AddSample(const InputSample& sample) {
+    if (m_window.count > 0 && sample.timeUs - m_windowStart >= WINDOW_US) {
+        CloseWindow();
+    }
+    if (m_window.count == 0) {
+        m_windowStart = sample.timeUs;
+    }
+
+    const RawGamepad& pad = sample.pad;
+    int32_t values[4] = { pad.thumbLX, pad.thumbLY, pad.thumbRX, pad.thumbRY };
+    for (int i = 0; i < 4; i++) {
+        AxisStats& axis = m_window.axes[i];
+        AddAxis(values[i], &axis.sum, &axis.sumSq, &axis.min, &axis.max);
+    }
+    m_window.triggerMax[0] = Max<int>(m_window.triggerMax[0], pad.leftTrigger);
+    m_window.triggerMax[1] = Max<int>(m_window.triggerMax[1], pad.rightTrigger);
+    m_window.count++;
+
+    if (!sample.connected || pad.buttons != 0 ||
+        pad.leftTrigger >= REST_TRIGGER_LIMIT || pad.rightTrigger >= REST_TRIGGER_LIMIT) {
+        m_window.touched = true;
+    }
+}
+
+//==============================================================================
+// āAÎ~ȂŜ̏Wvɑ
+//==============================================================================
+void DeadzoneTuner::CloseWindow() {
+    if (m_window.count == 0) {
+        return;
+    }
+
+    bool resting = !m_window.touched;
+    for (const AxisStats& axis : m_window.axes) {
+        int64_t mean = axis.sum / m_window.count;
+        if (axis.max - axis.min >= REST_RANGE_LIMIT ||
+            mean >= REST_OFFSET_LIMIT || mean <= -REST_OFFSET_LIMIT) {
+            resting = false;
+        }
+    }
+
+    if (resting) {
+        for (int i = 0; i < 4; i++) {
+            AxisStats& total = m_total.axes[i];
+            const AxisStats& axis = m_window.axes[i];
+            total.sum += axis.sum;
+            total.sumSq += axis.sumSq;
+            if (axis.min < total.min) total.min = axis.min;
+            if (axis.max > total.max) total.max = axis.max;
+        }
+        m_total.triggerMax[0] = Max(m_total.triggerMax[0], m_window.triggerMax[0]);
+        m_total.triggerMax[1] = Max(m_total.triggerMax[1], m_window.triggerMax[1]);
+        m_total.count += m_window.count;
+    } else {
+        m_rejectedWindows++;
+    }
+
+    ClearWindow(&m_window);
+}
+
+//==============================================================================
+// 
+//==============================================================================
+bool DeadzoneTuner::Compute(GamepadCalibration* pCalibration, DeadzoneTuneReport* pReport) {
+    CloseWindow();
+
+    if (pReport != nullptr) {
+        pReport->acceptedSamples = m_total.count;
+        pReport->rejectedWindows = m_rejectedWindows;
+    }
+    if (m_total.count < MIN_REST_SAMPLES) {
+        return false;
+    }
+
+    GamepadCalibration calibration;
+    StickCalibration* pSticks[2] = { &calibration.leftStick, &calibration.rightStick };
+    for (int stick = 0; stick < 2; stick++) {
+        int32_t center[2];
+        int32_t envelope = 0;
+        float mean[2];
+        float sigma[2];
+        for (int a = 0; a < 2; a++) {
+            const AxisStats& axis = m_total.axes[stick * 2 + a];
+            double m = static_cast<double>(axis.sum) / m_total.count;
+            double variance = static_cast<double>(axis.sumSq) / m_total.count - m * m;
+            mean[a] = static_cast<float>(m);
+            sigma[a] = static_cast<float>(std::sqrt(Max(variance, 0.0)));
+            center[a] = static_cast<int32_t>(std::lround(m));
+            envelope = Max(envelope, Max(axis.max - center[a], center[a] - axis.min));
+        }
+
+        int32_t deadzone = envelope * SAFETY_RATIO_NUM / SAFETY_RATIO_DEN + SAFETY_MARGIN;
+        pSticks[stick]->centerX = static_cast<int16_t>(center[0]);
+        pSticks[stick]->centerY = static_cast<int16_t>(center[1]);
+        pSticks[stick]->deadzone = static_cast<int16_t>(Clamp(deadzone, MIN_DEADZONE, MAX_DEADZONE));
+
+        if (pReport != nullptr) {
+            StickNoiseReport& noise = (stick == 0) ? pReport->leftStick : pReport->rightStick;
+            noise.meanX = mean[0];
+            noise.meanY = mean[1];
+            noise.sigmaX = sigma[0];
+            noise.sigmaY = sigma[1];
+            noise.envelope = envelope;
+        }
+    }
+
+    // gK[͐Î~̍őlɏƂ납
+    calibration.leftTriggerThreshold = static_cast<uint8_t>(
+        Clamp(m_total.triggerMax[0] + TRIGGER_MARGIN, MIN_TRIGGER_THRESHOLD, MAX_TRIGGER_THRESHOLD));
+    calibration.rightTriggerThreshold = static_cast<uint8_t>(
+        Clamp(m_total.triggerMax[1] + TRIGGER_MARGIN, MIN_TRIGGER_THRESHOLD, MAX_TRIGGER_THRESHOLD));
+
+    // mCYŐ؂̂ŁAK̏悹͂Ȃ
+    calibration.extraDeadzone = 0.0f;
+
+    if (pReport != nullptr) {
+        pReport->leftTriggerMax = m_total.triggerMax[0];
+        pReport->rightTriggerMax = m_total.triggerMax[1];
+    }
+
+    *pCalibration = calibration;
+    return true;
+}
+
+//==============================================================================
+// Lu[Vt@Cǂݍ
+//==============================================================================
+bool LoadCalibrationProfile(const char* pPath, GamepadCalibration* pCalibration) {
+    FILE* pFile = nullptr;
+    if (fopen_s(&pFile, pPath, "r") != 0 || pFile == nullptr) {
+        return false;
+    }
+
+    GamepadCalibration calibration;
+    char line[128];
+    while (fgets(line, sizeof(line), pFile) != nullptr) {
+        if (line[0] == '#') continue;
+        char* pValue = strchr(line, ' ');
+        if (pValue == nullptr) continue;
+        *pValue++ = '\0';
+
+        // ŏt@Cǂނ̂ŁAKŊ镝i32767 - fbh][A255 - 臒lj
+        // 0ȉɂȂȂ悤Afbh][Compute()Ɠ͈͂ɁA臒l254܂łɎ߂
+        double value = atof(pValue);
+        int16_t axis = static_cast<int16_t>(Clamp(value, -32768.0, 32767.0));
+        int16_t deadzone = static_cast<int16_t>(Clamp(value, static_cast<double>(MIN_DEADZONE), static_cast<double>(MAX_DEADZONE)));
+        uint8_t trigger = static_cast<uint8_t>(Clamp(value, 0.0, 254.0));
+        if (strcmp(line, "left_center_x") == 0) calibration.leftStick.centerX = axis;
+        else if (strcmp(line, "left_center_y") == 0) calibration.leftStick.centerY = axis;
+        else if (strcmp(line, "left_deadzone") == 0) calibration.leftStick.deadzone = deadzone;
+        else if (strcmp(line, "right_center_x") == 0) calibration.rightStick.centerX = axis;
+        else if (strcmp(line, "right_center_y") == 0) calibration.rightStick.centerY = axis;
+        else if (strcmp(line, "right_deadzone") == 0) calibration.rightStick.deadzone = deadzone;
+        else if (strcmp(line, "left_trigger_threshold") == 0) calibration.leftTriggerThreshold = trigger;
+        else if (strcmp(line, "right_trigger_threshold") == 0) calibration.rightTriggerThreshold = trigger;
+        else if (strcmp(line, "extra_deadzone") == 0) calibration.extraDeadzone = static_cast<float>(Clamp(value, 0.0, 0.9));
+    }
+
+    fclose(pFile);
+    *pCalibration = calibration;
+    return true;
+}
+
+//==============================================================================
+// Lu[Vt@Cۑ
+//==============================================================================
+bool SaveCalibrationProfile(const char* pPath, const GamepadCalibration& calibration) {
+    FILE* pFile = nullptr;
+    if (fopen_s(&pFile, pPath, "w") != 0 || pFile == nullptr) {
+        return false;
+    }
+
+    fprintf(pFile, "# gamepad calibration\n");
+    fprintf(pFile, "left_center_x %d\n", calibration.leftStick.centerX);
+    fprintf(pFile, "left_center_y %d\n", calibration.leftStick.centerY);
+    fprintf(pFile, "left_deadzone %d\n", calibration.leftStick.deadzone);
+    fprintf(pFile, "right_center_x %d\n", calibration.rightStick.centerX);
+    fprintf(pFile, "right_center_y %d\n", calibration.rightStick.centerY);
+    fprintf(pFile, "right_deadzone %d\n", calibration.rightStick.deadzone);
+    fprintf(pFile, "left_trigger_threshold %d\n", calibration.leftTriggerThreshold);
+    fprintf(pFile, "right_trigger_threshold %d\n", calibration.rightTriggerThreshold);
+    fprintf(pFile, "extra_deadzone %.3f\n", calibration.extraDeadzone);
+
+    fclose(pFile);
+    return true;
+}
@@ -0,0 +1,85 @@
+/*****************************************************************//**
+ * \file   deadzone_tuner.h
+ * \brief  Î~̃XeBbN͂fbh][𐄒肷
+ *
+ * Tv莞ԂƂ̑ɋ؂A{^EXeBbN
+ * قƂǓĂȂuÎ~vƂďWvB
+ * Î~̕ς𒆐SAS̍ő̂mCYƂA
+ * ɗ]T𑫂̂̂Ƃ̍ŏfbh][ƂB
+ * Wv͑ZȂ̂ŁACu2bԂłL^t@Cł悤ɎgB
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+#include "gamepad_state.h"
+#include "input_codec.h"
+
+//==============================================================================
+// 茋ʂ̏ڍ
+//==============================================================================
+struct StickNoiseReport {
+    float meanX = 0.0f;         // Î~̕ρi̒lj
+    float meanY = 0.0f;
+    float sigmaX = 0.0f;        // W΍
+    float sigmaY = 0.0f;
+    int envelope = 0;           // S̍ő̂iƂ̑傫j
+};
+
+struct DeadzoneTuneReport {
+    int acceptedSamples = 0;    // Î~ƂĎgTv
+    int rejectedWindows = 0;    // GĂ̂Ŏ̂Ă̐
+    StickNoiseReport leftStick;
+    StickNoiseReport rightStick;
+    int leftTriggerMax = 0;     // Î~̃gK[̍ől
+    int rightTriggerMax = 0;
+};
+
+//==============================================================================
+// fbh][NX
+//==============================================================================
+class DeadzoneTuner {
+public:
+    // ɕKvȐÎ~Tv
+    static constexpr int MIN_REST_SAMPLES = 60;
+
+    DeadzoneTuner() { Reset(); }
+
+    void Reset();
+
+    // TvǉiɓnƁj
+    void AddSample(const InputSample& sample);
+
+    // Î~̃Tviȓ͊܂܂Ȃj
+    int GetAcceptedSamples() const { return m_total.count; }
+
+    // 肵ăLu[ViÎ~TvȂfalsej
+    bool Compute(GamepadCalibration* pCalibration, DeadzoneTuneReport* pReport = nullptr);
+
+private:
+    struct AxisStats {
+        int64_t sum;
+        int64_t sumSq;
+        int32_t min;
+        int32_t max;
+    };
+
+    struct WindowStats {
+        AxisStats axes[4];          // LX, LY, RX, RY
+        int triggerMax[2];
+        int count;
+        bool touched;               // {^EgK[ؒf
+    };
+
+    static void ClearWindow(WindowStats* pWindow);
+    void CloseWindow();
+
+    WindowStats m_window;
+    WindowStats m_total;
+    uint64_t m_windowStart;
+    int m_rejectedWindows;
+};
+
+// Lu[Vt@C̓ǂݏi1sɁuL[ lvj
+bool LoadCalibrationProfile(const char* pPath, GamepadCalibration* pCalibration);
+bool SaveCalibrationProfile(const char* pPath, const GamepadCalibration& calibration);
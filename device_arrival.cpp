@@ -0,0 +1,72 @@
+/*****************************************************************//**
+ * \file   device_arrival.cpp
+ * \brief  foCXǉ̒ʒmiRg[[ڑ̑ҋ@pj
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "device_arrival.h"
+
+#pragma comment(lib, "cfgmgr32.lib")
+
+//==============================================================================
+// o^E
+//==============================================================================
+bool DeviceArrivalWatcher::Start() {
+    if (IsActive()) {
+        return true;
+    }
+
+    m_hEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+    if (m_hEvent == nullptr) {
+        return false;
+    }
+
+    CM_NOTIFY_FILTER filter;
+    ZeroMemory(&filter, sizeof(CM_NOTIFY_FILTER));
+    filter.cbSize = sizeof(CM_NOTIFY_FILTER);
+    filter.Flags = CM_NOTIFY_FILTER_FLAG_ALL_INTERFACE_CLASSES;
+    filter.FilterType = CM_NOTIFY_FILTER_TYPE_DEVICEINTERFACE;
+
+    if (CM_Register_Notification(&filter, this, OnNotify, &m_hNotify) != CR_SUCCESS) {
+        m_hNotify = nullptr;
+        CloseHandle(m_hEvent);
+        m_hEvent = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void DeviceArrivalWatcher::Stop() {
+    // ͎s̃R[obNI܂Ŗ߂Ȃ̂ŁÂƃCxgĂ悢
+    if (m_hNotify != nullptr) {
+        CM_Unregister_Notification(m_hNotify);
+        m_hNotify = nullptr;
+    }
+    if (m_hEvent != nullptr) {
+        CloseHandle(m_hEvent);
+        m_hEvent = nullptr;
+    }
+    m_pending = 0;
+}
+
+//==============================================================================
+// ʒm̎󂯎
+//==============================================================================
+bool DeviceArrivalWatcher::ConsumeArrival() {
+    if (m_pending == 0) {
+        return false;
+    }
+    // ɃCxg߂itƊԂɗʒm̃Cxg܂ŏĐQ߂j
+    ResetEvent(m_hEvent);
+    return InterlockedExchange(&m_pending, 0) != 0;
+}
+
+DWORD CALLBACK DeviceArrivalWatcher::OnNotify(HCMNOTIFICATION, PVOID pContext, CM_NOTIFY_ACTION action,
+    PCM_NOTIFY_EVENT_DATA, DWORD) {
+    if (action == CM_NOTIFY_ACTION_DEVICEINTERFACEARRIVAL) {
+        DeviceArrivalWatcher* pWatcher = static_cast<DeviceArrivalWatcher*>(pContext);
+        InterlockedExchange(&pWatcher->m_pending, 1);
+        SetEvent(pWatcher->m_hEvent);
+    }
+    return ERROR_SUCCESS;
+}
@@ -0,0 +1,48 @@
+/*****************************************************************//**
+ * \file   device_arrival.h
+ * \brief  foCXǉ̒ʒmiRg[[ڑ̑ҋ@pj
+ *
+ * CM_Register_NotificationŃfoCXC^[tF[X̒ǉ󂯎A
+ * Cxg𗧂ĂBRg[[ȂXInput̃Xbg
+ * t[TɁÃCxgŖđ҂ĂB
+ *
+ * ǂ̃C^[tF[XNX̒ǉłiXInput̃pbhǂ̃NX
+ * 邩̓hCo[̂߁jB֌WȂfoCXŋNĂ
+ * Xbg1TōςށB
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include <windows.h>
+#include <cfgmgr32.h>
+
+//==============================================================================
+// foCXǉʒmNX
+//==============================================================================
+class DeviceArrivalWatcher {
+public:
+    DeviceArrivalWatcher() = default;
+    ~DeviceArrivalWatcher() { Stop(); }
+    DeviceArrivalWatcher(const DeviceArrivalWatcher&) = delete;
+    DeviceArrivalWatcher& operator=(const DeviceArrivalWatcher&) = delete;
+
+    // ʒmo^igȂȂfalseÂƂ͎ԂŒTȂj
+    bool Start();
+    void Stop();
+    bool IsActive() const { return m_hNotify != nullptr; }
+
+    // foCXǉƃVOiԂɂȂi蓮ZbgAConsumeArrivalŖ߂j
+    HANDLE GetEvent() const { return m_hEvent; }
+
+    // O񂩂ǉi΃Cxg߂j
+    bool ConsumeArrival();
+
+private:
+    static DWORD CALLBACK OnNotify(HCMNOTIFICATION hNotify, PVOID pContext, CM_NOTIFY_ACTION action,
+        PCM_NOTIFY_EVENT_DATA pEventData, DWORD eventDataSize);
+
+    HCMNOTIFICATION m_hNotify = nullptr;
+    HANDLE m_hEvent = nullptr;
+    // ʒm̓Xbhv[痈̂ŁAtOInterlockedœǂݏ
+    volatile LONG m_pending = 0;
+};
@@ -0,0 +1,125 @@
+/*****************************************************************//**
+ * \file   epoll_reader.cpp
+ * \brief  hidrawfoCXepollł܂Ƃ߂đ҂ǂݍ݃[v
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "epoll_reader.h"
+
+#ifdef __linux__
+#include <cerrno>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+//==============================================================================
+// EI
+//==============================================================================
+bool EpollInputReader::Initialize() {
+    Finalize();
+    m_epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (m_epollFd < 0) {
+        return false;
+    }
+    m_pBuffer = new uint8_t[READ_BUFFER_SIZE];
+    return true;
+}
+
+void EpollInputReader::Finalize() {
+    if (m_epollFd >= 0) {
+        close(m_epollFd);
+        m_epollFd = -1;
+    }
+    for (HidrawDevice*& pDevice : m_pDevices) {
+        pDevice = nullptr;
+    }
+    m_deviceCount = 0;
+    delete[] m_pBuffer;
+    m_pBuffer = nullptr;
+}
+
+//==============================================================================
+// foCXo^
+//==============================================================================
+int EpollInputReader::AddDevice(HidrawDevice* pDevice) {
+    if (m_epollFd < 0 || pDevice == nullptr || !pDevice->IsOpen()) {
+        return -1;
+    }
+
+    int slot = 0;
+    while (slot < MAX_DEVICES && m_pDevices[slot] != nullptr) {
+        slot++;
+    }
+    if (slot == MAX_DEVICES) {
+        return -1;
+    }
+
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.u32 = static_cast<uint32_t>(slot);
+    if (epoll_ctl(m_epollFd, EPOLL_CTL_ADD, pDevice->GetFd(), &event) < 0) {
+        return -1;
+    }
+
+    m_pDevices[slot] = pDevice;
+    m_deviceCount++;
+    return slot;
+}
+
+void EpollInputReader::RemoveDevice(int slot) {
+    HidrawDevice* pDevice = m_pDevices[slot];
+    if (pDevice == nullptr) {
+        return;
+    }
+    // ؒfŕfdepollŊOĂ
+    if (pDevice->IsOpen()) {
+        epoll_ctl(m_epollFd, EPOLL_CTL_DEL, pDevice->GetFd(), nullptr);
+    }
+    m_pDevices[slot] = nullptr;
+    m_deviceCount--;
+}
+
+//==============================================================================
+// ҋ@Ɠǂݍ
+//==============================================================================
+int EpollInputReader::Poll(int timeoutMs) {
+    m_updatedMask = 0;
+    m_disconnectedMask = 0;
+    if (m_epollFd < 0) {
+        return 0;
+    }
+
+    epoll_event events[MAX_DEVICES];
+    int count;
+    do {
+        count = epoll_wait(m_epollFd, events, MAX_DEVICES, timeoutMs);
+    } while (count < 0 && errno == EINTR);
+    m_waitCount++;
+    if (count <= 0) {
+        return 0;
+    }
+
+    int updated = 0;
+    for (int i = 0; i < count; i++) {
+        int slot = static_cast<int>(events[i].data.u32);
+        HidrawDevice* pDevice = m_pDevices[slot];
+        if (pDevice == nullptr) {
+            continue;
+        }
+        m_wakeCount++;
+
+        // EPOLLHUPłcĂ镪͓ǂłؒfɂ
+        int decoded = pDevice->Drain(m_pBuffer, READ_BUFFER_SIZE);
+        if (decoded < 0 || (events[i].events & EPOLLERR) != 0) {
+            m_disconnectedMask |= 1ull << slot;
+            RemoveDevice(slot);
+            continue;
+        }
+        if (decoded > 0) {
+            m_updatedMask |= 1ull << slot;
+            updated++;
+        }
+    }
+    return updated;
+}
+
+#endif // __linux__
@@ -0,0 +1,67 @@
+/*****************************************************************//**
+ * \file   epoll_reader.h
+ * \brief  hidrawfoCXepollł܂Ƃ߂đ҂ǂݍ݃[v
+ *
+ * SfoCXfd1epollɓo^ĂA1t[1epoll_wait()
+ * ǂ߂foCX󂯎B󂯎foCX͑傫ȃobt@
+ * ɂȂ܂œǂށB~܂Ăpbhɂ̓VXeR[1gȂ̂ŁA
+ * 16ȂĂĂׂ͎ۂɑĂ䐔ɂȂB
+ *
+ * foCX̏L͌ĂяoɎciHidrawDevicẽ|C^o^邾jB
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#ifdef __linux__
+#include <cstddef>
+#include <cstdint>
+#include "hidraw_device.h"
+
+//==============================================================================
+// epollǂݍ݃[vNX
+//==============================================================================
+class EpollInputReader {
+public:
+    // o^łfoCXiXVꂽfoCX̓rbg}XNŕԂj
+    static constexpr int MAX_DEVICES = 64;
+    // ǂݍ݃obt@iSfoCXŋLj
+    static constexpr size_t READ_BUFFER_SIZE = 64 * 1024;
+
+    EpollInputReader() = default;
+    ~EpollInputReader() { Finalize(); }
+    EpollInputReader(const EpollInputReader&) = delete;
+    EpollInputReader& operator=(const EpollInputReader&) = delete;
+
+    bool Initialize();
+    void Finalize();
+
+    // foCXo^ăXbgԍԂitEo^sȂ-1j
+    int AddDevice(HidrawDevice* pDevice);
+    void RemoveDevice(int slot);
+    HidrawDevice* GetDevice(int slot) const { return m_pDevices[slot]; }
+    int GetDeviceCount() const { return m_deviceCount; }
+
+    // ǂ߂foCX҂ēǂށitimeoutMs0ő҂ȂA-1łƑ҂j
+    // ߂l͏ԂXVꂽfoCXAؒfꂽfoCX͎œo^O
+    int Poll(int timeoutMs);
+
+    // ߂Poll()ōXVꂽEؒfꂽXbgirbgƁj
+    uint64_t GetUpdatedMask() const { return m_updatedMask; }
+    uint64_t GetDisconnectedMask() const { return m_disconnectedMask; }
+
+    // viVXeR[̉񐔂̊mFpj
+    uint64_t GetWaitCount() const { return m_waitCount; }
+    uint64_t GetWakeCount() const { return m_wakeCount; }
+
+private:
+    int m_epollFd = -1;
+    HidrawDevice* m_pDevices[MAX_DEVICES] = {};
+    int m_deviceCount = 0;
+    uint64_t m_updatedMask = 0;
+    uint64_t m_disconnectedMask = 0;
+    uint64_t m_waitCount = 0;
+    uint64_t m_wakeCount = 0;
+    uint8_t* m_pBuffer = nullptr;
+};
+
+#endif // __linux__
@@ -7,263 +7,18 @@
 
  // Windows.hmin/max}N𖳌
 #define NOMINMAX
-#include "game_controller.h"
-#include <algorithm>
+#include "game_controller_impl.h"
 
 //==============================================================================
-// ÓIoϐ̒`
+// ̑gݍ킹𐶐
 //==============================================================================
-DWORD GameController::s_controllerIndex = 0;
-GamepadState GameController::s_currentState = {};
-GamepadState GameController::s_prevState = {};
-bool GameController::s_isVibrating = false;
-DWORD GameController::s_vibrationEndTime = 0;
-float GameController::s_leftMotorSpeed = 0.0f;
-float GameController::s_rightMotorSpeed = 0.0f;
+template class BasicController<XInputBackend, AxialDeadzone, NoFilter>;
 
 //==============================================================================
-// 萔`
+// obe[̕ϊ
 //==============================================================================
-namespace {
-    // fbh][
-    constexpr SHORT STICK_DEADZONE_LEFT = XINPUT_GAMEPAD_LEFT_THUMB_DEADZONE;
-    constexpr SHORT STICK_DEADZONE_RIGHT = XINPUT_GAMEPAD_RIGHT_THUMB_DEADZONE;
-    constexpr BYTE TRIGGER_THRESHOLD = XINPUT_GAMEPAD_TRIGGER_THRESHOLD;
-
-    // gK[fW^{^ƂĔ肷臒li50%j
-    constexpr BYTE TRIGGER_DIGITAL_THRESHOLD = 128;
-
-    // Nv֐iOj
-    template<typename T>
-    T Clamp(T value, T minVal, T maxVal) {
-        if (value < minVal) return minVal;
-        if (value > maxVal) return maxVal;
-        return value;
-    }
-
-    // ŏliOj
-    template<typename T>
-    T Min(T a, T b) {
-        return (a < b) ? a : b;
-    }
-
-    // őliOj
-    template<typename T>
-    T Max(T a, T b) {
-        return (a > b) ? a : b;
-    }
-}
-
-//==============================================================================
-// 
-//==============================================================================
-bool GameController::Initialize() {
-    s_controllerIndex = 0;
-    s_currentState = {};
-    s_prevState = {};
-    s_isVibrating = false;
-    s_vibrationEndTime = 0;
-    s_leftMotorSpeed = 0.0f;
-    s_rightMotorSpeed = 0.0f;
-
-    // ڑĂRg[[T
-    for (DWORD i = 0; i < XUSER_MAX_COUNT; i++) {
-        XINPUT_STATE state;
-        if (XInputGetState(i, &state) == ERROR_SUCCESS) {
-            s_controllerIndex = i;
-            return true;
-        }
-    }
-    return false;
-}
-
-//==============================================================================
-// I
-//==============================================================================
-void GameController::Finalize() {
-    StopVibration();
-    s_currentState = {};
-    s_prevState = {};
-}
-
-//==============================================================================
-// XVit[Ăяoj
-//==============================================================================
-void GameController::Update() {
-    UpdateState();
-
-    // oCu[V̎ԊǗ
-    if (s_isVibrating && GetTickCount64() >= s_vibrationEndTime) {
-        StopVibration();
-    }
-}
-
-//==============================================================================
-// ԍXV
-//==============================================================================
-bool GameController::UpdateState() {
-    s_prevState = s_currentState;
-
-    XINPUT_STATE state;
-    ZeroMemory(&state, sizeof(XINPUT_STATE));
-
-    DWORD result = XInputGetState(s_controllerIndex, &state);
-
-    // ڑĂȂꍇÃRg[[T
-    if (result != ERROR_SUCCESS) {
-        for (DWORD i = 0; i < XUSER_MAX_COUNT; i++) {
-            if (XInputGetState(i, &state) == ERROR_SUCCESS) {
-                s_controllerIndex = i;
-                result = ERROR_SUCCESS;
-                break;
-            }
-        }
-        if (result != ERROR_SUCCESS) {
-            s_currentState.connected = false;
-            return false;
-        }
-    }
-
-    s_currentState.connected = true;
-    WORD buttons = state.Gamepad.wButtons;
-
-    // \L[
-    s_currentState.dpadUp = (buttons & XINPUT_GAMEPAD_DPAD_UP) != 0;
-    s_currentState.dpadDown = (buttons & XINPUT_GAMEPAD_DPAD_DOWN) != 0;
-    s_currentState.dpadLeft = (buttons & XINPUT_GAMEPAD_DPAD_LEFT) != 0;
-    s_currentState.dpadRight = (buttons & XINPUT_GAMEPAD_DPAD_RIGHT) != 0;
-
-    // C{^
-    s_currentState.buttonDown = (buttons & XINPUT_GAMEPAD_A) != 0;
-    s_currentState.buttonRight = (buttons & XINPUT_GAMEPAD_B) != 0;
-    s_currentState.buttonLeft = (buttons & XINPUT_GAMEPAD_X) != 0;
-    s_currentState.buttonUp = (buttons & XINPUT_GAMEPAD_Y) != 0;
-
-    // V_[{^
-    s_currentState.buttonL1 = (buttons & XINPUT_GAMEPAD_LEFT_SHOULDER) != 0;
-    s_currentState.buttonR1 = (buttons & XINPUT_GAMEPAD_RIGHT_SHOULDER) != 0;
-
-    // XeBbN
-    s_currentState.buttonL3 = (buttons & XINPUT_GAMEPAD_LEFT_THUMB) != 0;
-    s_currentState.buttonR3 = (buttons & XINPUT_GAMEPAD_RIGHT_THUMB) != 0;
-
-    // VXe{^
-    s_currentState.buttonStart = (buttons & XINPUT_GAMEPAD_START) != 0;
-    s_currentState.buttonSelect = (buttons & XINPUT_GAMEPAD_BACK) != 0;
-
-    // gK[
-    s_currentState.leftTrigger = NormalizeTriggerValue(state.Gamepad.bLeftTrigger, TRIGGER_THRESHOLD);
-    s_currentState.rightTrigger = NormalizeTriggerValue(state.Gamepad.bRightTrigger, TRIGGER_THRESHOLD);
-    s_currentState.buttonL2 = (state.Gamepad.bLeftTrigger > TRIGGER_DIGITAL_THRESHOLD);
-    s_currentState.buttonR2 = (state.Gamepad.bRightTrigger > TRIGGER_DIGITAL_THRESHOLD);
-
-    // XeBbN
-    float rawLeftX = NormalizeStickValue(state.Gamepad.sThumbLX, STICK_DEADZONE_LEFT);
-    float rawLeftY = NormalizeStickValue(state.Gamepad.sThumbLY, STICK_DEADZONE_LEFT);
-    float rawRightX = NormalizeStickValue(state.Gamepad.sThumbRX, STICK_DEADZONE_RIGHT);
-    float rawRightY = NormalizeStickValue(state.Gamepad.sThumbRY, STICK_DEADZONE_RIGHT);
-
-    s_currentState.leftStickX = GamepadState::ApplyDeadzone(rawLeftX);
-    s_currentState.leftStickY = GamepadState::ApplyDeadzone(-rawLeftY);
-    s_currentState.rightStickX = GamepadState::ApplyDeadzone(rawRightX);
-    s_currentState.rightStickY = GamepadState::ApplyDeadzone(-rawRightY);
-
-    return true;
-}
-
-//==============================================================================
-// XeBbNl̐K
-//==============================================================================
-float GameController::NormalizeStickValue(SHORT value, SHORT deadzone) {
-    if (value < 0) {
-        if (value > -deadzone) return 0.0f;
-    } else {
-        if (value < deadzone) return 0.0f;
-    }
-
-    constexpr float MAX_VALUE = 32767.0f;
-    float normalizedValue;
-
-    if (value > 0) {
-        normalizedValue = static_cast<float>(value - deadzone) / (MAX_VALUE - deadzone);
-    } else {
-        normalizedValue = static_cast<float>(value + deadzone) / (MAX_VALUE - deadzone);
-    }
-
-    return Clamp(normalizedValue, -1.0f, 1.0f);
-}
-
-//==============================================================================
-// gK[l̐K
-//==============================================================================
-float GameController::NormalizeTriggerValue(BYTE value, BYTE threshold) {
-    if (value < threshold) {
-        return 0.0f;
-    }
-
-    constexpr float MAX_VALUE = 255.0f;
-    float normalizedValue = static_cast<float>(value - threshold) / (MAX_VALUE - threshold);
-    return Min(1.0f, normalizedValue);
-}
-
-//==============================================================================
-// oCu[VJni[^[xj
-//==============================================================================
-void GameController::StartVibration(float intensity, float duration) {
-    StartVibrationEx(intensity, intensity, duration);
-}
-
-//==============================================================================
-// oCu[VJniEʁj
-//==============================================================================
-void GameController::StartVibrationEx(float leftMotor, float rightMotor, float duration) {
-    s_leftMotorSpeed = Clamp(leftMotor, 0.0f, 1.0f);
-    s_rightMotorSpeed = Clamp(rightMotor, 0.0f, 1.0f);
-
-    XINPUT_VIBRATION vibration;
-    ZeroMemory(&vibration, sizeof(XINPUT_VIBRATION));
-    vibration.wLeftMotorSpeed = static_cast<WORD>(s_leftMotorSpeed * 65535.0f);
-    vibration.wRightMotorSpeed = static_cast<WORD>(s_rightMotorSpeed * 65535.0f);
-
-    XInputSetState(s_controllerIndex, &vibration);
-
-    s_isVibrating = true;
-    s_vibrationEndTime = GetTickCount64() + static_cast<DWORD>(duration * 1000.0f);
-}
-
-//==============================================================================
-// oCu[VJniݒ\́j
-//==============================================================================
-void GameController::StartVibrationEx(const VibrationSettings& settings) {
-    StartVibrationEx(settings.leftMotor, settings.rightMotor, settings.duration);
-}
-
-//==============================================================================
-// oCu[V~
-//==============================================================================
-void GameController::StopVibration() {
-    XINPUT_VIBRATION vibration;
-    ZeroMemory(&vibration, sizeof(XINPUT_VIBRATION));
-    XInputSetState(s_controllerIndex, &vibration);
-
-    s_isVibrating = false;
-    s_leftMotorSpeed = 0.0f;
-    s_rightMotorSpeed = 0.0f;
-}
-
-//==============================================================================
-// obe[擾
-//==============================================================================
-BatteryInfo GameController::GetBatteryInfo() {
+BatteryInfo MakeBatteryInfo(const XINPUT_BATTERY_INFORMATION& batteryInfo) {
     BatteryInfo info = {};
-
-    XINPUT_BATTERY_INFORMATION batteryInfo;
-    DWORD result = XInputGetBatteryInformation(s_controllerIndex, BATTERY_DEVTYPE_GAMEPAD, &batteryInfo);
-
-    if (result != ERROR_SUCCESS) {
-        return info;
-    }
-
     info.hasBatteryInfo = true;
 
     switch (batteryInfo.BatteryType) {
@@ -305,55 +60,3 @@ BatteryInfo GameController::GetBatteryInfo() {
 
     return info;
 }
-
-//==============================================================================
-// Rg[[\͎擾
-//==============================================================================
-ControllerCapabilities GameController::GetCapabilities() {
-    ControllerCapabilities caps = {};
-
-    XINPUT_CAPABILITIES xinputCaps;
-    DWORD result = XInputGetCapabilities(s_controllerIndex, XINPUT_FLAG_GAMEPAD, &xinputCaps);
-
-    if (result != ERROR_SUCCESS) {
-        return caps;
-    }
-
-    caps.isValid = true;
-    caps.isGamepad = (xinputCaps.Type == XINPUT_DEVTYPE_GAMEPAD);
-    caps.hasVoiceSupport = (xinputCaps.Flags & XINPUT_CAPS_VOICE_SUPPORTED) != 0;
-    caps.hasFFB = (xinputCaps.Flags & XINPUT_CAPS_FFB_SUPPORTED) != 0;
-    caps.isWireless = (xinputCaps.Flags & XINPUT_CAPS_WIRELESS) != 0;
-    caps.buttons = xinputCaps.Gamepad.wButtons;
-    caps.leftTrigger = xinputCaps.Gamepad.bLeftTrigger;
-    caps.rightTrigger = xinputCaps.Gamepad.bRightTrigger;
-    caps.thumbLX = xinputCaps.Gamepad.sThumbLX;
-    caps.thumbLY = xinputCaps.Gamepad.sThumbLY;
-    caps.thumbRX = xinputCaps.Gamepad.sThumbRX;
-    caps.thumbRY = xinputCaps.Gamepad.sThumbRY;
-
-    return caps;
-}
-
-//==============================================================================
-// L[Xg[N擾
-//==============================================================================
-bool GameController::GetKeystroke(XINPUT_KEYSTROKE* pKeystroke) {
-    if (pKeystroke == nullptr) {
-        return false;
-    }
-
-    DWORD result = XInputGetKeystroke(s_controllerIndex, 0, pKeystroke);
-    return (result == ERROR_SUCCESS);
-}
-
-//==============================================================================
-// I[fBIfoCXID擾
-//==============================================================================
-bool GameController::GetAudioDeviceIds(LPWSTR pRenderDeviceId, UINT* pRenderCount,
-    LPWSTR pCaptureDeviceId, UINT* pCaptureCount) {
-    DWORD result = XInputGetAudioDeviceIds(s_controllerIndex,
-        pRenderDeviceId, pRenderCount,
-        pCaptureDeviceId, pCaptureCount);
-    return (result == ERROR_SUCCESS);
-}
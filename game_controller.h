@@ -2,78 +2,30 @@
  * \file   game_controller.h
  * \brief  Q[Rg[[͊ǗiXInputŁj
  *
+ * BasicController̓obNGhEfbh][EtB^[ev[g
+ * |V[Ŏ󂯎ÓINXBGameController͊̑gݍ킹
+ * iXInputEƂ̃fbh][EtB^[Ȃj̕ʖŁA
+ * ̂game_controller.cppňxB
+ * ʂ̑gݍ킹gƂgame_controller_impl.hCN[hB
+ *
  * \date   2026/1/5
  *********************************************************************/
 #pragma once
 #include <windows.h>
 #include <Xinput.h>
-#include <cmath>
-
-#pragma comment(lib, "xinput.lib")
-
- //==============================================================================
- // Q[pbhԍ\
- //==============================================================================
-struct GamepadState {
-    // XeBbNi-1.0 ~ 1.0j
-    float leftStickX = 0.0f;
-    float leftStickY = 0.0f;
-
-    // EXeBbNi-1.0 ~ 1.0j
-    float rightStickX = 0.0f;
-    float rightStickY = 0.0f;
-
-    // gK[i0.0 ~ 1.0j
-    float leftTrigger = 0.0f;
-    float rightTrigger = 0.0f;
-
-    // \L[
-    bool dpadUp = false;
-    bool dpadDown = false;
-    bool dpadLeft = false;
-    bool dpadRight = false;
-
-    // C{^iʒux[Xj
-    bool buttonDown = false;   // A
-    bool buttonRight = false;  // B
-    bool buttonLeft = false;   // X
-    bool buttonUp = false;     // Y
-
-    // V_[{^iLB/RBj
-    bool buttonL1 = false;
-    bool buttonR1 = false;
-
-    // gK[{^iLT/RTj- fW^
-    bool buttonL2 = false;
-    bool buttonR2 = false;
-
-    // XeBbN݁iLS/RSj
-    bool buttonL3 = false;
-    bool buttonR3 = false;
-
-    // VXe{^
-    bool buttonStart = false;
-    bool buttonSelect = false;
+#include "button_layout.h"
+#include "button_tracker.h"
+#include "controller_policies.h"
+#include "device_arrival.h"
+#include "key_repeat.h"
+#include "stick_direction.h"
+#include "gamepad_state.h"
 
-    // ڑ
-    bool connected = false;
-
-    // ꂩ̃{^Ă邩
-    bool IsAnyButtonPressed() const {
-        return buttonDown || buttonRight || buttonLeft || buttonUp ||
-            buttonL1 || buttonR1 || buttonL2 || buttonR2 ||
-            buttonL3 || buttonR3 ||
-            buttonStart || buttonSelect ||
-            dpadUp || dpadDown || dpadLeft || dpadRight;
-    }
+// Ԏ擾֐̌^iXInputGetStateƓVOl`j
+typedef DWORD(WINAPI* StateSourceFunc)(DWORD dwUserIndex, XINPUT_STATE* pState);
 
-    // fbh][Kp
-    static float ApplyDeadzone(float value, float deadzone = 0.15f) {
-        if (std::fabs(value) < deadzone) return 0.0f;
-        float sign = (value > 0) ? 1.0f : -1.0f;
-        return sign * (std::fabs(value) - deadzone) / (1.0f - deadzone);
-    }
-};
+// 擾֐̌^i}CNbj
+typedef ULONGLONG(*ClockFunc)();
 
 //==============================================================================
 // oCu[Vݒ\
@@ -94,6 +46,9 @@ struct BatteryInfo {
     const char* levelText = "";     // x̃eLXg\
 };
 
+// XInput̃obe[\pɕϊ
+BatteryInfo MakeBatteryInfo(const XINPUT_BATTERY_INFORMATION& batteryInfo);
+
 //==============================================================================
 // Rg[[\͏\
 //==============================================================================
@@ -113,9 +68,10 @@ struct ControllerCapabilities {
 };
 
 //==============================================================================
-// Q[Rg[[NXiXInputŁj
+// Q[Rg[[NXi|V[wŁj
 //==============================================================================
-class GameController {
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+class BasicController {
 public:
     //==========================================================================
     // EIEXV
@@ -127,9 +83,44 @@ public:
     //==========================================================================
     // Ԏ擾
     //==========================================================================
-    static const GamepadState& GetCurrentState() { return s_currentState; }
-    static const GamepadState& GetPrevState() { return s_prevState; }
+    static const GamepadState& GetCurrentState() { return CurrentState(); }
+    static const GamepadState& GetPrevState() { return PrevState(); }
+    // ݂̏Ԃ16oCgɋl߂́iEʐMɕۑ`j
+    static CompactGamepadState GetCompactState() {
+        CompactGamepadState compact;
+        PackGamepadState(CurrentState(), &compact);
+        return compact;
+    }
     static DWORD GetControllerIndex() { return s_controllerIndex; }
+    // fbh][O̐̓͒l
+    static const RawGamepad& GetRawGamepad() { return s_rawGamepad; }
+    // zuϊ̃{^iPAD_BUTTON_*AL2/R2PAD_BUTTON_*_TRIGGERj
+    static uint32_t GetButtons() { return s_buttons[s_currentIndex]; }
+    static uint32_t GetPrevButtons() { return s_buttons[s_currentIndex ^ 1]; }
+
+    //==========================================================================
+    // Lu[ViXeBbNSEfbh][j
+    //==========================================================================
+    static void SetCalibration(const GamepadCalibration& calibration) { s_calibration = calibration; }
+    static const GamepadCalibration& GetCalibration() { return s_calibration; }
+
+    //==========================================================================
+    // {^zuiʃ{^̕בւƌELZ̊蓖āj
+    //==========================================================================
+    static void SetButtonLayout(ButtonLayoutType type) { s_pButtonLayout = &::GetButtonLayout(type); }
+    static const ButtonLayout& GetButtonLayout() { return *s_pButtonLayout; }
+
+    //==========================================================================
+    // ̓\[XE\[XieXg⃊vCōւ\j
+    //==========================================================================
+    // nullptrŃobNGhiXInputGetStatejɖ߂
+    static void SetStateSource(StateSourceFunc pFunc);
+    // nullptrQueryPerformanceCounterɖ߂
+    static void SetClockSource(ClockFunc pFunc);
+    // ݎi}CNbj
+    static ULONGLONG GetTimeUs();
+    // ߂Update()i}CNbj
+    static ULONGLONG GetUpdateTime() { return s_updateTime; }
 
     //==========================================================================
     // oCu[V
@@ -167,89 +158,183 @@ public:
     //==========================================================================
     // PressiĂԂtruej
     //==========================================================================
-    static bool IsPressed_ButtonDown() { return s_currentState.buttonDown; }
-    static bool IsPressed_ButtonRight() { return s_currentState.buttonRight; }
-    static bool IsPressed_ButtonLeft() { return s_currentState.buttonLeft; }
-    static bool IsPressed_ButtonUp() { return s_currentState.buttonUp; }
-    static bool IsPressed_L1() { return s_currentState.buttonL1; }
-    static bool IsPressed_R1() { return s_currentState.buttonR1; }
-    static bool IsPressed_L2() { return s_currentState.buttonL2; }
-    static bool IsPressed_R2() { return s_currentState.buttonR2; }
-    static bool IsPressed_L3() { return s_currentState.buttonL3; }
-    static bool IsPressed_R3() { return s_currentState.buttonR3; }
-    static bool IsPressed_Start() { return s_currentState.buttonStart; }
-    static bool IsPressed_Select() { return s_currentState.buttonSelect; }
-    static bool IsPressed_DpadUp() { return s_currentState.dpadUp; }
-    static bool IsPressed_DpadDown() { return s_currentState.dpadDown; }
-    static bool IsPressed_DpadLeft() { return s_currentState.dpadLeft; }
-    static bool IsPressed_DpadRight() { return s_currentState.dpadRight; }
+    static bool IsPressed_ButtonDown() { return CurrentState().buttonDown; }
+    static bool IsPressed_ButtonRight() { return CurrentState().buttonRight; }
+    static bool IsPressed_ButtonLeft() { return CurrentState().buttonLeft; }
+    static bool IsPressed_ButtonUp() { return CurrentState().buttonUp; }
+    static bool IsPressed_L1() { return CurrentState().buttonL1; }
+    static bool IsPressed_R1() { return CurrentState().buttonR1; }
+    static bool IsPressed_L2() { return CurrentState().buttonL2; }
+    static bool IsPressed_R2() { return CurrentState().buttonR2; }
+    static bool IsPressed_L3() { return CurrentState().buttonL3; }
+    static bool IsPressed_R3() { return CurrentState().buttonR3; }
+    static bool IsPressed_Start() { return CurrentState().buttonStart; }
+    static bool IsPressed_Select() { return CurrentState().buttonSelect; }
+    static bool IsPressed_Confirm() { return CurrentState().buttonConfirm; }
+    static bool IsPressed_Cancel() { return CurrentState().buttonCancel; }
+    static bool IsPressed_DpadUp() { return CurrentState().dpadUp; }
+    static bool IsPressed_DpadDown() { return CurrentState().dpadDown; }
+    static bool IsPressed_DpadLeft() { return CurrentState().dpadLeft; }
+    static bool IsPressed_DpadRight() { return CurrentState().dpadRight; }
 
     //==========================================================================
     // TriggeriuԂtruej
     //==========================================================================
-    static bool IsTrigger_ButtonDown() { return s_currentState.buttonDown && !s_prevState.buttonDown; }
-    static bool IsTrigger_ButtonRight() { return s_currentState.buttonRight && !s_prevState.buttonRight; }
-    static bool IsTrigger_ButtonLeft() { return s_currentState.buttonLeft && !s_prevState.buttonLeft; }
-    static bool IsTrigger_ButtonUp() { return s_currentState.buttonUp && !s_prevState.buttonUp; }
-    static bool IsTrigger_L1() { return s_currentState.buttonL1 && !s_prevState.buttonL1; }
-    static bool IsTrigger_R1() { return s_currentState.buttonR1 && !s_prevState.buttonR1; }
-    static bool IsTrigger_L2() { return s_currentState.buttonL2 && !s_prevState.buttonL2; }
-    static bool IsTrigger_R2() { return s_currentState.buttonR2 && !s_prevState.buttonR2; }
-    static bool IsTrigger_L3() { return s_currentState.buttonL3 && !s_prevState.buttonL3; }
-    static bool IsTrigger_R3() { return s_currentState.buttonR3 && !s_prevState.buttonR3; }
-    static bool IsTrigger_Start() { return s_currentState.buttonStart && !s_prevState.buttonStart; }
-    static bool IsTrigger_Select() { return s_currentState.buttonSelect && !s_prevState.buttonSelect; }
-    static bool IsTrigger_DpadUp() { return s_currentState.dpadUp && !s_prevState.dpadUp; }
-    static bool IsTrigger_DpadDown() { return s_currentState.dpadDown && !s_prevState.dpadDown; }
-    static bool IsTrigger_DpadLeft() { return s_currentState.dpadLeft && !s_prevState.dpadLeft; }
-    static bool IsTrigger_DpadRight() { return s_currentState.dpadRight && !s_prevState.dpadRight; }
+    static bool IsTrigger_ButtonDown() { return CurrentState().buttonDown && !PrevState().buttonDown; }
+    static bool IsTrigger_ButtonRight() { return CurrentState().buttonRight && !PrevState().buttonRight; }
+    static bool IsTrigger_ButtonLeft() { return CurrentState().buttonLeft && !PrevState().buttonLeft; }
+    static bool IsTrigger_ButtonUp() { return CurrentState().buttonUp && !PrevState().buttonUp; }
+    static bool IsTrigger_L1() { return CurrentState().buttonL1 && !PrevState().buttonL1; }
+    static bool IsTrigger_R1() { return CurrentState().buttonR1 && !PrevState().buttonR1; }
+    static bool IsTrigger_L2() { return CurrentState().buttonL2 && !PrevState().buttonL2; }
+    static bool IsTrigger_R2() { return CurrentState().buttonR2 && !PrevState().buttonR2; }
+    static bool IsTrigger_L3() { return CurrentState().buttonL3 && !PrevState().buttonL3; }
+    static bool IsTrigger_R3() { return CurrentState().buttonR3 && !PrevState().buttonR3; }
+    static bool IsTrigger_Start() { return CurrentState().buttonStart && !PrevState().buttonStart; }
+    static bool IsTrigger_Select() { return CurrentState().buttonSelect && !PrevState().buttonSelect; }
+    static bool IsTrigger_Confirm() { return CurrentState().buttonConfirm && !PrevState().buttonConfirm; }
+    static bool IsTrigger_Cancel() { return CurrentState().buttonCancel && !PrevState().buttonCancel; }
+    static bool IsTrigger_DpadUp() { return CurrentState().dpadUp && !PrevState().dpadUp; }
+    static bool IsTrigger_DpadDown() { return CurrentState().dpadDown && !PrevState().dpadDown; }
+    static bool IsTrigger_DpadLeft() { return CurrentState().dpadLeft && !PrevState().dpadLeft; }
+    static bool IsTrigger_DpadRight() { return CurrentState().dpadRight && !PrevState().dpadRight; }
 
     //==========================================================================
     // ReleaseiuԂtruej
     //==========================================================================
-    static bool IsRelease_ButtonDown() { return !s_currentState.buttonDown && s_prevState.buttonDown; }
-    static bool IsRelease_ButtonRight() { return !s_currentState.buttonRight && s_prevState.buttonRight; }
-    static bool IsRelease_ButtonLeft() { return !s_currentState.buttonLeft && s_prevState.buttonLeft; }
-    static bool IsRelease_ButtonUp() { return !s_currentState.buttonUp && s_prevState.buttonUp; }
-    static bool IsRelease_L1() { return !s_currentState.buttonL1 && s_prevState.buttonL1; }
-    static bool IsRelease_R1() { return !s_currentState.buttonR1 && s_prevState.buttonR1; }
-    static bool IsRelease_L2() { return !s_currentState.buttonL2 && s_prevState.buttonL2; }
-    static bool IsRelease_R2() { return !s_currentState.buttonR2 && s_prevState.buttonR2; }
-    static bool IsRelease_L3() { return !s_currentState.buttonL3 && s_prevState.buttonL3; }
-    static bool IsRelease_R3() { return !s_currentState.buttonR3 && s_prevState.buttonR3; }
-    static bool IsRelease_Start() { return !s_currentState.buttonStart && s_prevState.buttonStart; }
-    static bool IsRelease_Select() { return !s_currentState.buttonSelect && s_prevState.buttonSelect; }
-    static bool IsRelease_DpadUp() { return !s_currentState.dpadUp && s_prevState.dpadUp; }
-    static bool IsRelease_DpadDown() { return !s_currentState.dpadDown && s_prevState.dpadDown; }
-    static bool IsRelease_DpadLeft() { return !s_currentState.dpadLeft && s_prevState.dpadLeft; }
-    static bool IsRelease_DpadRight() { return !s_currentState.dpadRight && s_prevState.dpadRight; }
+    static bool IsRelease_ButtonDown() { return !CurrentState().buttonDown && PrevState().buttonDown; }
+    static bool IsRelease_ButtonRight() { return !CurrentState().buttonRight && PrevState().buttonRight; }
+    static bool IsRelease_ButtonLeft() { return !CurrentState().buttonLeft && PrevState().buttonLeft; }
+    static bool IsRelease_ButtonUp() { return !CurrentState().buttonUp && PrevState().buttonUp; }
+    static bool IsRelease_L1() { return !CurrentState().buttonL1 && PrevState().buttonL1; }
+    static bool IsRelease_R1() { return !CurrentState().buttonR1 && PrevState().buttonR1; }
+    static bool IsRelease_L2() { return !CurrentState().buttonL2 && PrevState().buttonL2; }
+    static bool IsRelease_R2() { return !CurrentState().buttonR2 && PrevState().buttonR2; }
+    static bool IsRelease_L3() { return !CurrentState().buttonL3 && PrevState().buttonL3; }
+    static bool IsRelease_R3() { return !CurrentState().buttonR3 && PrevState().buttonR3; }
+    static bool IsRelease_Start() { return !CurrentState().buttonStart && PrevState().buttonStart; }
+    static bool IsRelease_Select() { return !CurrentState().buttonSelect && PrevState().buttonSelect; }
+    static bool IsRelease_Confirm() { return !CurrentState().buttonConfirm && PrevState().buttonConfirm; }
+    static bool IsRelease_Cancel() { return !CurrentState().buttonCancel && PrevState().buttonCancel; }
+    static bool IsRelease_DpadUp() { return !CurrentState().dpadUp && PrevState().dpadUp; }
+    static bool IsRelease_DpadDown() { return !CurrentState().dpadDown && PrevState().dpadDown; }
+    static bool IsRelease_DpadLeft() { return !CurrentState().dpadLeft && PrevState().dpadLeft; }
+    static bool IsRelease_DpadRight() { return !CurrentState().dpadRight && PrevState().dpadRight; }
+
+    //==========================================================================
+    // ԁEAŔibuttonPAD_BUTTON_*1Azuϊj
+    //==========================================================================
+    static const ButtonTracker& GetButtonTracker() { return s_buttonTracker; }
+    static uint64_t GetHeldTime(uint32_t button) { return s_buttonTracker.GetHeldTime(button); }
+    static bool IsHeldFor(uint32_t button, uint64_t durationUs) { return s_buttonTracker.IsHeldFor(button, durationUs); }
+    static bool IsLongPress(uint32_t button, uint64_t durationUs) { return s_buttonTracker.IsLongPress(button, durationUs); }
+    static uint32_t GetFramesSinceRelease(uint32_t button) { return s_buttonTracker.GetFramesSinceRelease(button); }
+    static int GetTapCount(uint32_t button) { return s_buttonTracker.GetTapCount(button); }
+    static bool IsDoubleTap(uint32_t button) { return s_buttonTracker.IsDoubleTap(button); }
+    static void SetTapInterval(uint64_t intervalUs) { s_buttonTracker.SetTapInterval(intervalUs); }
+
+    //==========================================================================
+    // j[i\L[ƍXeBbÑL[s[gAŔj
+    //==========================================================================
+    static void SetKeyRepeatSettings(const KeyRepeatSettings& settings) { s_keyRepeat.SetSettings(settings); }
+    static const KeyRepeatSettings& GetKeyRepeatSettings() { return s_keyRepeat.GetSettings(); }
+    // uԂƌJԂ̃^C~Otrue
+    static bool IsRepeat_Up() { return (s_keyRepeat.GetEvents() & PAD_BUTTON_DPAD_UP) != 0; }
+    static bool IsRepeat_Down() { return (s_keyRepeat.GetEvents() & PAD_BUTTON_DPAD_DOWN) != 0; }
+    static bool IsRepeat_Left() { return (s_keyRepeat.GetEvents() & PAD_BUTTON_DPAD_LEFT) != 0; }
+    static bool IsRepeat_Right() { return (s_keyRepeat.GetEvents() & PAD_BUTTON_DPAD_RIGHT) != 0; }
+    // ̃t[Ői߂񐔁it[[gႢ1t[ɕɂȂj
+    static int GetRepeatCount(uint32_t direction) { return s_keyRepeat.GetEventCount(direction); }
 
     //==========================================================================
     // XeBbNEgK[l擾
     //==========================================================================
-    static float GetLeftStickX() { return s_currentState.leftStickX; }
-    static float GetLeftStickY() { return s_currentState.leftStickY; }
-    static float GetRightStickX() { return s_currentState.rightStickX; }
-    static float GetRightStickY() { return s_currentState.rightStickY; }
-    static float GetLeftTrigger() { return s_currentState.leftTrigger; }
-    static float GetRightTrigger() { return s_currentState.rightTrigger; }
+    static float GetLeftStickX() { return CurrentState().leftStickX; }
+    static float GetLeftStickY() { return CurrentState().leftStickY; }
+    static float GetRightStickX() { return CurrentState().rightStickX; }
+    static float GetRightStickY() { return CurrentState().rightStickY; }
+    static float GetLeftTrigger() { return CurrentState().leftTrigger; }
+    static float GetRightTrigger() { return CurrentState().rightTrigger; }
+
+    //==========================================================================
+    // XeBbN̕i4E8AqXeVXtj
+    //==========================================================================
+    // ẼXeBbNɓݒg
+    static void SetStickDirectionSettings(const StickDirectionSettings& settings) {
+        s_leftDirection.SetSettings(settings);
+        s_rightDirection.SetSettings(settings);
+    }
+    static StickDirection GetLeftStickDirection() { return s_leftDirection.GetDirection(); }
+    static StickDirection GetRightStickDirection() { return s_rightDirection.GetDirection(); }
+    static bool IsChanged_LeftStickDirection() { return s_leftDirection.IsChanged(); }
+    static bool IsChanged_RightStickDirection() { return s_rightDirection.IsChanged(); }
 
     //==========================================================================
     // ڑ
     //==========================================================================
-    static bool IsConnected() { return s_currentState.connected; }
+    static bool IsConnected() { return CurrentState().connected; }
+
+    //==========================================================================
+    // ڑ̑ҋ@iRg[[ȂCPUgȂj
+    //==========================================================================
+    // ڑ̓Xbg𖈃t[TAfoCXǉ̒ʒm
+    // ԊuL΂Ȃ̍ĒT̎܂ŉȂi̓\[Xւ͖Tj
+    // ǉʒm̃CxgiʒmgȂłnullptrj
+    static HANDLE GetArrivalEvent() { return s_arrivalWatcher.GetEvent(); }
+    // ɒT܂ł̎ԁi~bjAڑT߂Ă0
+    // ڑ͂GetArrivalEvent()ő҂ĂUpdate()Ăׂ΂悢
+    static DWORD GetIdleWaitMs();
 
 private:
     static bool UpdateState();
-    static float NormalizeStickValue(SHORT value, SHORT deadzone);
-    static float NormalizeTriggerValue(BYTE value, BYTE threshold);
+    static bool IsProbeDue();
+    static void SetDisconnected();
+
+    // Ԏ擾iւ΂AȂ΃obNGhj
+    static DWORD ReadState(DWORD userIndex, XINPUT_STATE* pState) {
+        return (s_pStateSource != nullptr) ? s_pStateSource(userIndex, pState) : Backend::GetState(userIndex, pState);
+    }
 
     // Rg[[CfbNXi0-3j
     static DWORD s_controllerIndex;
 
-    // ݃t[ƑOt[̏
-    static GamepadState s_currentState;
-    static GamepadState s_prevState;
+    // ̓\[XinullptrȂobNGh𒼐ڌĂԁjE\[X
+    static StateSourceFunc s_pStateSource;
+    static ClockFunc s_pClockSource;
+    static ULONGLONG s_updateTime;
+
+    // ݃t[ƑOt[̏ԁi2݂ɎgAt[̃Rs[Ȃj
+    static GamepadState s_states[2];
+    static int s_currentIndex;
+    static GamepadState& CurrentState() { return s_states[s_currentIndex]; }
+    static GamepadState& PrevState() { return s_states[s_currentIndex ^ 1]; }
+
+    // ݃t[̐̓͒l
+    static RawGamepad s_rawGamepad;
+
+    // ݃t[ƑOt[̃{^izuϊ̃rbg}XNAYs_statesƓj
+    static uint32_t s_buttons[2];
+
+    // {^Ƃ̉EAŉ
+    static ButtonTracker s_buttonTracker;
+
+    // j[̃L[s[g
+    static KeyRepeat s_keyRepeat;
+
+    // XeBbN̕
+    static StickQuantizer s_leftDirection;
+    static StickQuantizer s_rightDirection;
+
+    // ڑ̍ĒTifoCXǉ̒ʒmEɒTEԊuj
+    static DeviceArrivalWatcher s_arrivalWatcher;
+    static ULONGLONG s_nextProbeTime;
+    static ULONGLONG s_probeInterval;
+
+    // fR[hɎgLu[V
+    static GamepadCalibration s_calibration;
+
+    // fR[hɎg{^zu
+    static const ButtonLayout* s_pButtonLayout;
 
     // oCu[V֘A
     static bool s_isVibrating;
@@ -257,3 +342,9 @@ private:
     static float s_leftMotorSpeed;
     static float s_rightMotorSpeed;
 };
+
+//==============================================================================
+// ̑gݍ킹
+//==============================================================================
+extern template class BasicController<XInputBackend, AxialDeadzone, NoFilter>;
+typedef BasicController<XInputBackend, AxialDeadzone, NoFilter> GameController;
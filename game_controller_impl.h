@@ -0,0 +1,426 @@
+/*****************************************************************//**
+ * \file   game_controller_impl.h
+ * \brief  BasicController̎iev[g`j
+ *
+ * ̑gݍ킹iGameControllerjgame_controller.cppŐς݂Ȃ̂ŁA
+ * CN[ĥ͕ʂ̃|V[̑gݍ킹g|Pʂł悢B
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include "game_controller.h"
+
+//==============================================================================
+// ÓIoϐ̒`
+//==============================================================================
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+DWORD BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_controllerIndex = 0;
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+StateSourceFunc BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_pStateSource = nullptr;
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+ClockFunc BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_pClockSource = nullptr;
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+ULONGLONG BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_updateTime = 0;
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+GamepadState BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_states[2] = {};
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+int BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_currentIndex = 0;
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+RawGamepad BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_rawGamepad = {};
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+uint32_t BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_buttons[2] = {};
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+ButtonTracker BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_buttonTracker;
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+KeyRepeat BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_keyRepeat;
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+StickQuantizer BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_leftDirection;
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+StickQuantizer BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_rightDirection;
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+DeviceArrivalWatcher BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_arrivalWatcher;
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+ULONGLONG BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_nextProbeTime = 0;
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+ULONGLONG BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_probeInterval = 0;
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+GamepadCalibration BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_calibration;
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+const ButtonLayout* BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_pButtonLayout = &BUTTON_LAYOUTS[BUTTON_LAYOUT_XBOX];
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+bool BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_isVibrating = false;
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+DWORD BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_vibrationEndTime = 0;
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+float BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_leftMotorSpeed = 0.0f;
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+float BasicController<Backend, DeadzonePolicy, FilterPolicy>::s_rightMotorSpeed = 0.0f;
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace controller_detail {
+    // ڑ̍ĒTԊuiTČȂтɔ{ɂj
+    constexpr ULONGLONG IDLE_PROBE_FIRST_US = 250000;
+    // iǉʒmgƂ͎肱ڂ΍􂾂Ȃ̂Œj
+    constexpr ULONGLONG IDLE_PROBE_MAX_US = 2000000;
+    constexpr ULONGLONG IDLE_PROBE_NOTIFIED_MAX_US = 10000000;
+
+    // Nv֐iOj
+    template<typename T>
+    T Clamp(T value, T minVal, T maxVal) {
+        if (value < minVal) return minVal;
+        if (value > maxVal) return maxVal;
+        return value;
+    }
+
+    // ŏliOj
+    template<typename T>
+    T Min(T a, T b) {
+        return (a < b) ? a : b;
+    }
+
+    // őliOj
+    template<typename T>
+    T Max(T a, T b) {
+        return (a > b) ? a : b;
+    }
+}
+
+//==============================================================================
+// 
+//==============================================================================
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+bool BasicController<Backend, DeadzonePolicy, FilterPolicy>::Initialize() {
+    s_controllerIndex = 0;
+    s_states[0] = {};
+    s_states[1] = {};
+    s_currentIndex = 0;
+    s_rawGamepad = {};
+    s_buttons[0] = 0;
+    s_buttons[1] = 0;
+    s_buttonTracker.Reset();
+    s_keyRepeat.Reset();
+    s_leftDirection.Reset();
+    s_rightDirection.Reset();
+    s_isVibrating = false;
+    s_vibrationEndTime = 0;
+    s_leftMotorSpeed = 0.0f;
+    s_rightMotorSpeed = 0.0f;
+    s_updateTime = GetTimeUs();
+    s_nextProbeTime = 0;
+    s_probeInterval = controller_detail::IDLE_PROBE_FIRST_US;
+    s_arrivalWatcher.Start();
+
+    // ڑĂRg[[T
+    for (DWORD i = 0; i < XUSER_MAX_COUNT; i++) {
+        XINPUT_STATE state;
+        if (ReadState(i, &state) == ERROR_SUCCESS) {
+            s_controllerIndex = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+//==============================================================================
+// I
+//==============================================================================
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+void BasicController<Backend, DeadzonePolicy, FilterPolicy>::Finalize() {
+    StopVibration();
+    s_arrivalWatcher.Stop();
+    s_states[0] = {};
+    s_states[1] = {};
+}
+
+//==============================================================================
+// XVit[Ăяoj
+//==============================================================================
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+void BasicController<Backend, DeadzonePolicy, FilterPolicy>::Update() {
+    s_updateTime = GetTimeUs();
+    UpdateState();
+    const GamepadState& current = CurrentState();
+    uint32_t buttons = s_buttons[s_currentIndex];
+    s_buttonTracker.Update(buttons, s_updateTime);
+    if (current.connected) {
+        s_keyRepeat.Update(buttons, current.leftStickX, current.leftStickY, s_updateTime);
+        s_leftDirection.Update(current.leftStickX, current.leftStickY);
+        s_rightDirection.Update(current.rightStickX, current.rightStickY);
+    } else {
+        s_keyRepeat.Update(0, 0.0f, 0.0f, s_updateTime);
+        s_leftDirection.Update(0.0f, 0.0f);
+        s_rightDirection.Update(0.0f, 0.0f);
+    }
+
+    // oCu[V̎ԊǗ
+    if (s_isVibrating && GetTickCount64() >= s_vibrationEndTime) {
+        StopVibration();
+    }
+}
+
+//==============================================================================
+// ̓\[Xݒ
+//==============================================================================
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+void BasicController<Backend, DeadzonePolicy, FilterPolicy>::SetStateSource(StateSourceFunc pFunc) {
+    s_pStateSource = pFunc;
+}
+
+//==============================================================================
+// \[Xݒ
+//==============================================================================
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+void BasicController<Backend, DeadzonePolicy, FilterPolicy>::SetClockSource(ClockFunc pFunc) {
+    s_pClockSource = pFunc;
+}
+
+//==============================================================================
+// ݎ擾i}CNbj
+//==============================================================================
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+ULONGLONG BasicController<Backend, DeadzonePolicy, FilterPolicy>::GetTimeUs() {
+    if (s_pClockSource != nullptr) {
+        return s_pClockSource();
+    }
+
+    static LARGE_INTEGER s_frequency = {};
+    if (s_frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&s_frequency);
+    }
+
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+
+    // I[o[t[Ȃ悤bƒ[ɕĕϊ
+    ULONGLONG seconds = counter.QuadPart / s_frequency.QuadPart;
+    ULONGLONG remainder = counter.QuadPart % s_frequency.QuadPart;
+    return seconds * 1000000ULL + remainder * 1000000ULL / s_frequency.QuadPart;
+}
+
+//==============================================================================
+// ڑ̑ҋ@
+//==============================================================================
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+DWORD BasicController<Backend, DeadzonePolicy, FilterPolicy>::GetIdleWaitMs() {
+    if (CurrentState().connected || s_pStateSource != nullptr) {
+        return 0;
+    }
+    ULONGLONG now = GetTimeUs();
+    if (now >= s_nextProbeTime) {
+        return 0;
+    }
+    return static_cast<DWORD>((s_nextProbeTime - now + 999) / 1000);
+}
+
+//==============================================================================
+// ڑɃXbgT
+//==============================================================================
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+bool BasicController<Backend, DeadzonePolicy, FilterPolicy>::IsProbeDue() {
+    // ւ̓\[X͖t[̒lɈӖ̂ŊԈȂ
+    if (s_pStateSource != nullptr) {
+        return true;
+    }
+    if (s_arrivalWatcher.ConsumeArrival()) {
+        return true;
+    }
+    return s_updateTime >= s_nextProbeTime;
+}
+
+//==============================================================================
+// ԍXV
+//==============================================================================
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+bool BasicController<Backend, DeadzonePolicy, FilterPolicy>::UpdateState() {
+    // Ot[݂̌Ot[ƂĎcA֍̏Ԃ
+    s_currentIndex ^= 1;
+    GamepadState& current = CurrentState();
+    const GamepadState& prev = PrevState();
+
+    // ڑ͒TɂȂ܂ŉǂ܂Ȃi󂫃Xbg̖₢킹͏dj
+    if (!prev.connected && !IsProbeDue()) {
+        SetDisconnected();
+        return false;
+    }
+
+    XINPUT_STATE state;
+    ZeroMemory(&state, sizeof(XINPUT_STATE));
+
+    DWORD result = ReadState(s_controllerIndex, &state);
+
+    // ڑĂȂꍇÃRg[[T
+    if (result != ERROR_SUCCESS) {
+        for (DWORD i = 0; i < XUSER_MAX_COUNT; i++) {
+            if (ReadState(i, &state) == ERROR_SUCCESS) {
+                s_controllerIndex = i;
+                result = ERROR_SUCCESS;
+                break;
+            }
+        }
+        if (result != ERROR_SUCCESS) {
+            // ȂΎɒT܂ł̊ԊuL΂
+            ULONGLONG maxInterval = s_arrivalWatcher.IsActive() ?
+                controller_detail::IDLE_PROBE_NOTIFIED_MAX_US : controller_detail::IDLE_PROBE_MAX_US;
+            s_nextProbeTime = s_updateTime + s_probeInterval;
+            s_probeInterval = controller_detail::Min(s_probeInterval * 2, maxInterval);
+            SetDisconnected();
+            return false;
+        }
+    }
+    s_nextProbeTime = 0;
+    s_probeInterval = controller_detail::IDLE_PROBE_FIRST_US;
+
+    s_rawGamepad.buttons = state.Gamepad.wButtons;
+    s_rawGamepad.leftTrigger = state.Gamepad.bLeftTrigger;
+    s_rawGamepad.rightTrigger = state.Gamepad.bRightTrigger;
+    s_rawGamepad.thumbLX = state.Gamepad.sThumbLX;
+    s_rawGamepad.thumbLY = state.Gamepad.sThumbLY;
+    s_rawGamepad.thumbRX = state.Gamepad.sThumbRX;
+    s_rawGamepad.thumbRY = state.Gamepad.sThumbRY;
+
+    // ̒l͋L^pɂ̂܂܎cAfR[hɂ͕בւ{^g
+    RawGamepad remapped = s_rawGamepad;
+    remapped.buttons = s_pButtonLayout->remap.Apply(s_rawGamepad.buttons);
+    // fR[hׂ͂Ă̒l̂ŁA2t[O̒gcĂĂ\Ȃ
+    DecodeGamepadButtons(remapped, s_calibration, &current);
+    DeadzonePolicy::DecodeSticks(s_rawGamepad, s_calibration, &current);
+    FilterPolicy::Apply(&current, prev);
+
+    uint32_t buttons = remapped.buttons;
+    if (current.buttonL2) buttons |= PAD_BUTTON_LEFT_TRIGGER;
+    if (current.buttonR2) buttons |= PAD_BUTTON_RIGHT_TRIGGER;
+    s_buttons[s_currentIndex] = buttons;
+
+    return true;
+}
+
+//==============================================================================
+// ڑ̏Ԃɂ
+//==============================================================================
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+void BasicController<Backend, DeadzonePolicy, FilterPolicy>::SetDisconnected() {
+    // l͑Ot[̂܂܎cAڑԂ𗎂Ƃ
+    CurrentState() = PrevState();
+    CurrentState().connected = false;
+    s_rawGamepad = {};
+    s_buttons[s_currentIndex] = 0;
+}
+
+//==============================================================================
+// oCu[VJni[^[xj
+//==============================================================================
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+void BasicController<Backend, DeadzonePolicy, FilterPolicy>::StartVibration(float intensity, float duration) {
+    StartVibrationEx(intensity, intensity, duration);
+}
+
+//==============================================================================
+// oCu[VJniEʁj
+//==============================================================================
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+void BasicController<Backend, DeadzonePolicy, FilterPolicy>::StartVibrationEx(float leftMotor, float rightMotor, float duration) {
+    s_leftMotorSpeed = controller_detail::Clamp(leftMotor, 0.0f, 1.0f);
+    s_rightMotorSpeed = controller_detail::Clamp(rightMotor, 0.0f, 1.0f);
+
+    XINPUT_VIBRATION vibration;
+    ZeroMemory(&vibration, sizeof(XINPUT_VIBRATION));
+    vibration.wLeftMotorSpeed = static_cast<WORD>(s_leftMotorSpeed * 65535.0f);
+    vibration.wRightMotorSpeed = static_cast<WORD>(s_rightMotorSpeed * 65535.0f);
+
+    Backend::SetState(s_controllerIndex, &vibration);
+
+    s_isVibrating = true;
+    s_vibrationEndTime = GetTickCount64() + static_cast<DWORD>(duration * 1000.0f);
+}
+
+//==============================================================================
+// oCu[VJniݒ\́j
+//==============================================================================
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+void BasicController<Backend, DeadzonePolicy, FilterPolicy>::StartVibrationEx(const VibrationSettings& settings) {
+    StartVibrationEx(settings.leftMotor, settings.rightMotor, settings.duration);
+}
+
+//==============================================================================
+// oCu[V~
+//==============================================================================
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+void BasicController<Backend, DeadzonePolicy, FilterPolicy>::StopVibration() {
+    XINPUT_VIBRATION vibration;
+    ZeroMemory(&vibration, sizeof(XINPUT_VIBRATION));
+    Backend::SetState(s_controllerIndex, &vibration);
+
+    s_isVibrating = false;
+    s_leftMotorSpeed = 0.0f;
+    s_rightMotorSpeed = 0.0f;
+}
+
+//==============================================================================
+// obe[擾
+//==============================================================================
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+BatteryInfo BasicController<Backend, DeadzonePolicy, FilterPolicy>::GetBatteryInfo() {
+    XINPUT_BATTERY_INFORMATION batteryInfo;
+    DWORD result = Backend::GetBatteryInformation(s_controllerIndex, BATTERY_DEVTYPE_GAMEPAD, &batteryInfo);
+    if (result != ERROR_SUCCESS) {
+        return BatteryInfo();
+    }
+    return MakeBatteryInfo(batteryInfo);
+}
+
+//==============================================================================
+// Rg[[\͎擾
+//==============================================================================
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+ControllerCapabilities BasicController<Backend, DeadzonePolicy, FilterPolicy>::GetCapabilities() {
+    ControllerCapabilities caps = {};
+
+    XINPUT_CAPABILITIES xinputCaps;
+    DWORD result = Backend::GetCapabilities(s_controllerIndex, XINPUT_FLAG_GAMEPAD, &xinputCaps);
+
+    if (result != ERROR_SUCCESS) {
+        return caps;
+    }
+
+    caps.isValid = true;
+    caps.isGamepad = (xinputCaps.Type == XINPUT_DEVTYPE_GAMEPAD);
+    caps.hasVoiceSupport = (xinputCaps.Flags & XINPUT_CAPS_VOICE_SUPPORTED) != 0;
+    caps.hasFFB = (xinputCaps.Flags & XINPUT_CAPS_FFB_SUPPORTED) != 0;
+    caps.isWireless = (xinputCaps.Flags & XINPUT_CAPS_WIRELESS) != 0;
+    caps.buttons = xinputCaps.Gamepad.wButtons;
+    caps.leftTrigger = xinputCaps.Gamepad.bLeftTrigger;
+    caps.rightTrigger = xinputCaps.Gamepad.bRightTrigger;
+    caps.thumbLX = xinputCaps.Gamepad.sThumbLX;
+    caps.thumbLY = xinputCaps.Gamepad.sThumbLY;
+    caps.thumbRX = xinputCaps.Gamepad.sThumbRX;
+    caps.thumbRY = xinputCaps.Gamepad.sThumbRY;
+
+    return caps;
+}
+
+//==============================================================================
+// L[Xg[N擾
+//==============================================================================
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+bool BasicController<Backend, DeadzonePolicy, FilterPolicy>::GetKeystroke(XINPUT_KEYSTROKE* pKeystroke) {
+    if (pKeystroke == nullptr) {
+        return false;
+    }
+
+    DWORD result = Backend::GetKeystroke(s_controllerIndex, pKeystroke);
+    return (result == ERROR_SUCCESS);
+}
+
+//==============================================================================
+// I[fBIfoCXID擾
+//==============================================================================
+template<typename Backend, typename DeadzonePolicy, typename FilterPolicy>
+bool BasicController<Backend, DeadzonePolicy, FilterPolicy>::GetAudioDeviceIds(LPWSTR pRenderDeviceId, UINT* pRenderCount,
+    LPWSTR pCaptureDeviceId, UINT* pCaptureCount) {
+    DWORD result = Backend::GetAudioDeviceIds(s_controllerIndex,
+        pRenderDeviceId, pRenderCount,
+        pCaptureDeviceId, pCaptureCount);
+    return (result == ERROR_SUCCESS);
+}
@@ -0,0 +1,199 @@
+/*****************************************************************//**
+ * \file   gamepad_state.cpp
+ * \brief  Q[pbhԂƐ͂̃fR[hivbgtH[ˑj
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "gamepad_state.h"
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // Lu[Vw莞̐ݒ
+    const GamepadCalibration DEFAULT_CALIBRATION;
+
+    // gK[fW^{^ƂĔ肷臒li50%j
+    constexpr uint8_t TRIGGER_DIGITAL_THRESHOLD = 128;
+
+    constexpr float PI = 3.14159265f;
+    constexpr float HALF_PI = 1.57079633f;
+
+    // l߂Ƃ̍ől
+    constexpr float COMPACT_STICK_MAX = 32767.0f;
+    constexpr float COMPACT_TRIGGER_MAX = 255.0f;
+
+    // -1.0 ~ 1.0ľܓŐցi͈̔͂ɂ炵Đ؂̂Ă̂ŕŕ򂵂Ȃj
+    int16_t PackStick(float value) {
+        value = (value < -1.0f) ? -1.0f : value;
+        value = (value > 1.0f) ? 1.0f : value;
+        int32_t biased = static_cast<int32_t>(value * COMPACT_STICK_MAX + (COMPACT_STICK_MAX + 0.5f));
+        return static_cast<int16_t>(biased - static_cast<int32_t>(COMPACT_STICK_MAX));
+    }
+
+    // 0.0 ~ 1.0ľܓŐ
+    uint8_t PackTrigger(float value) {
+        value = (value < 0.0f) ? 0.0f : value;
+        value = (value > 1.0f) ? 1.0f : value;
+        return static_cast<uint8_t>(value * COMPACT_TRIGGER_MAX + 0.5f);
+    }
+}
+
+//==============================================================================
+// ̓͒lQ[pbhԂ
+//==============================================================================
+void DecodeGamepad(const RawGamepad& raw, GamepadState* pState) {
+    DecodeGamepad(raw, DEFAULT_CALIBRATION, pState);
+}
+
+void DecodeGamepad(const RawGamepad& raw, const GamepadCalibration& calibration, GamepadState* pState) {
+    DecodeGamepadButtons(raw, calibration, pState);
+    DecodeAxialSticks(raw, calibration, pState);
+}
+
+//==============================================================================
+// {^EgK[̃fR[h
+//==============================================================================
+void DecodeGamepadButtons(const RawGamepad& raw, const GamepadCalibration& calibration, GamepadState* pState) {
+    pState->connected = true;
+    uint16_t buttons = raw.buttons;
+
+    // \L[
+    pState->dpadUp = (buttons & PAD_BUTTON_DPAD_UP) != 0;
+    pState->dpadDown = (buttons & PAD_BUTTON_DPAD_DOWN) != 0;
+    pState->dpadLeft = (buttons & PAD_BUTTON_DPAD_LEFT) != 0;
+    pState->dpadRight = (buttons & PAD_BUTTON_DPAD_RIGHT) != 0;
+
+    // C{^
+    pState->buttonDown = (buttons & PAD_BUTTON_A) != 0;
+    pState->buttonRight = (buttons & PAD_BUTTON_B) != 0;
+    pState->buttonLeft = (buttons & PAD_BUTTON_X) != 0;
+    pState->buttonUp = (buttons & PAD_BUTTON_Y) != 0;
+
+    // V_[{^
+    pState->buttonL1 = (buttons & PAD_BUTTON_LEFT_SHOULDER) != 0;
+    pState->buttonR1 = (buttons & PAD_BUTTON_RIGHT_SHOULDER) != 0;
+
+    // XeBbN
+    pState->buttonL3 = (buttons & PAD_BUTTON_LEFT_THUMB) != 0;
+    pState->buttonR3 = (buttons & PAD_BUTTON_RIGHT_THUMB) != 0;
+
+    // VXe{^
+    pState->buttonStart = (buttons & PAD_BUTTON_START) != 0;
+    pState->buttonSelect = (buttons & PAD_BUTTON_BACK) != 0;
+
+    // ELZi{^zu̕בւe[uʂƂj
+    pState->buttonConfirm = (buttons & PAD_BUTTON_CONFIRM) != 0;
+    pState->buttonCancel = (buttons & PAD_BUTTON_CANCEL) != 0;
+
+    // gK[
+    pState->leftTrigger = NormalizeTriggerValue(raw.leftTrigger, calibration.leftTriggerThreshold);
+    pState->rightTrigger = NormalizeTriggerValue(raw.rightTrigger, calibration.rightTriggerThreshold);
+    pState->buttonL2 = (raw.leftTrigger > TRIGGER_DIGITAL_THRESHOLD);
+    pState->buttonR2 = (raw.rightTrigger > TRIGGER_DIGITAL_THRESHOLD);
+}
+
+//==============================================================================
+// l߂ԂƂ̕ϊ
+//==============================================================================
+void PackGamepadState(const GamepadState& state, CompactGamepadState* pCompact) {
+    // {^̕т͓͎ŗ\ÔŁAɂȂȂ`Őς
+    uint32_t buttons = 0;
+    buttons |= state.dpadUp ? PAD_BUTTON_DPAD_UP : 0;
+    buttons |= state.dpadDown ? PAD_BUTTON_DPAD_DOWN : 0;
+    buttons |= state.dpadLeft ? PAD_BUTTON_DPAD_LEFT : 0;
+    buttons |= state.dpadRight ? PAD_BUTTON_DPAD_RIGHT : 0;
+    buttons |= state.buttonStart ? PAD_BUTTON_START : 0;
+    buttons |= state.buttonSelect ? PAD_BUTTON_BACK : 0;
+    buttons |= state.buttonL3 ? PAD_BUTTON_LEFT_THUMB : 0;
+    buttons |= state.buttonR3 ? PAD_BUTTON_RIGHT_THUMB : 0;
+    buttons |= state.buttonL1 ? PAD_BUTTON_LEFT_SHOULDER : 0;
+    buttons |= state.buttonR1 ? PAD_BUTTON_RIGHT_SHOULDER : 0;
+    buttons |= state.buttonConfirm ? PAD_BUTTON_CONFIRM : 0;
+    buttons |= state.buttonCancel ? PAD_BUTTON_CANCEL : 0;
+    buttons |= state.buttonDown ? PAD_BUTTON_A : 0;
+    buttons |= state.buttonRight ? PAD_BUTTON_B : 0;
+    buttons |= state.buttonLeft ? PAD_BUTTON_X : 0;
+    buttons |= state.buttonUp ? PAD_BUTTON_Y : 0;
+    buttons |= state.buttonL2 ? PAD_BUTTON_LEFT_TRIGGER : 0;
+    buttons |= state.buttonR2 ? PAD_BUTTON_RIGHT_TRIGGER : 0;
+
+    pCompact->buttons = buttons;
+    pCompact->leftStickX = PackStick(state.leftStickX);
+    pCompact->leftStickY = PackStick(state.leftStickY);
+    pCompact->rightStickX = PackStick(state.rightStickX);
+    pCompact->rightStickY = PackStick(state.rightStickY);
+    pCompact->leftTrigger = PackTrigger(state.leftTrigger);
+    pCompact->rightTrigger = PackTrigger(state.rightTrigger);
+    pCompact->flags = state.connected ? COMPACT_FLAG_CONNECTED : 0;
+    pCompact->reserved = 0;
+}
+
+void UnpackGamepadState(const CompactGamepadState& compact, GamepadState* pState) {
+    uint32_t buttons = compact.buttons;
+    pState->dpadUp = (buttons & PAD_BUTTON_DPAD_UP) != 0;
+    pState->dpadDown = (buttons & PAD_BUTTON_DPAD_DOWN) != 0;
+    pState->dpadLeft = (buttons & PAD_BUTTON_DPAD_LEFT) != 0;
+    pState->dpadRight = (buttons & PAD_BUTTON_DPAD_RIGHT) != 0;
+    pState->buttonDown = (buttons & PAD_BUTTON_A) != 0;
+    pState->buttonRight = (buttons & PAD_BUTTON_B) != 0;
+    pState->buttonLeft = (buttons & PAD_BUTTON_X) != 0;
+    pState->buttonUp = (buttons & PAD_BUTTON_Y) != 0;
+    pState->buttonL1 = (buttons & PAD_BUTTON_LEFT_SHOULDER) != 0;
+    pState->buttonR1 = (buttons & PAD_BUTTON_RIGHT_SHOULDER) != 0;
+    pState->buttonL2 = (buttons & PAD_BUTTON_LEFT_TRIGGER) != 0;
+    pState->buttonR2 = (buttons & PAD_BUTTON_RIGHT_TRIGGER) != 0;
+    pState->buttonL3 = (buttons & PAD_BUTTON_LEFT_THUMB) != 0;
+    pState->buttonR3 = (buttons & PAD_BUTTON_RIGHT_THUMB) != 0;
+    pState->buttonStart = (buttons & PAD_BUTTON_START) != 0;
+    pState->buttonSelect = (buttons & PAD_BUTTON_BACK) != 0;
+    pState->buttonConfirm = (buttons & PAD_BUTTON_CONFIRM) != 0;
+    pState->buttonCancel = (buttons & PAD_BUTTON_CANCEL) != 0;
+
+    pState->leftStickX = compact.GetLeftStickX();
+    pState->leftStickY = compact.GetLeftStickY();
+    pState->rightStickX = compact.GetRightStickX();
+    pState->rightStickY = compact.GetRightStickY();
+    pState->leftTrigger = compact.GetLeftTrigger();
+    pState->rightTrigger = compact.GetRightTrigger();
+    pState->connected = compact.IsConnected();
+    pState->InvalidatePolar();
+}
+
+//==============================================================================
+// px
+//==============================================================================
+float StickAtan2(float y, float x) {
+#ifdef GAMEPAD_EXACT_POLAR
+    return std::atan2(y, x);
+#else
+    // 0 ~ 1̔ɂĂA0 ~ /4atan̑ŋߎ
+    float absX = std::fabs(x);
+    float absY = std::fabs(y);
+    float maxValue = (absX > absY) ? absX : absY;
+    float minValue = (absX > absY) ? absY : absX;
+    if (maxValue == 0.0f) {
+        return 0.0f;
+    }
+    float a = minValue / maxValue;
+    float s = a * a;
+    float angle = ((-0.0464964749f * s + 0.15931422f) * s - 0.327622764f) * s * a + a;
+
+    // یɖ߂
+    if (absY > absX) angle = HALF_PI - angle;
+    if (x < 0.0f) angle = PI - angle;
+    return (y < 0.0f) ? -angle : angle;
+#endif
+}
+
+//==============================================================================
+// XeBbN̑傫Epxi߂ēǂ܂ꂽƂvZj
+//==============================================================================
+void GamepadState::ComputePolar(int stick) const {
+    float x = (stick == 0) ? leftStickX : rightStickX;
+    // Y͏オȂ̂Ŕ]ď𐳂ɂ
+    float y = (stick == 0) ? -leftStickY : -rightStickY;
+    polarMagnitude[stick] = std::sqrt(x * x + y * y);
+    polarAngle[stick] = StickAtan2(y, x);
+    polarValid |= static_cast<uint8_t>(1 << stick);
+}
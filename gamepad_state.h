@@ -0,0 +1,284 @@
+/*****************************************************************//**
+ * \file   gamepad_state.h
+ * \brief  Q[pbhԂƐ͂̃fR[hivbgtH[ˑj
+ *
+ * XeBbN̑傫Epx͏߂ēǂ񂾂ƂɌvZāAɃXeBbN̒l
+ * ܂Ŏg񂷁Bpx͊őߎi덷0.0003WAjA
+ * GAMEPAD_EXACT_POLAR`ărhstd::atan2gB
+ *
+ * CompactGamepadState̓fR[hς݂̏Ԃ16oCgɋl߂ۑ`
+ * ivC[Ƃ̗EʐMpjBfloat̒l͓ǂނƂɖ߂B
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include <cmath>
+#include <cstdint>
+
+//==============================================================================
+// {^̃rbg蓖āiXINPUT_GAMEPAD_*Ɠlj
+//==============================================================================
+constexpr uint16_t PAD_BUTTON_DPAD_UP = 0x0001;
+constexpr uint16_t PAD_BUTTON_DPAD_DOWN = 0x0002;
+constexpr uint16_t PAD_BUTTON_DPAD_LEFT = 0x0004;
+constexpr uint16_t PAD_BUTTON_DPAD_RIGHT = 0x0008;
+constexpr uint16_t PAD_BUTTON_START = 0x0010;
+constexpr uint16_t PAD_BUTTON_BACK = 0x0020;
+constexpr uint16_t PAD_BUTTON_LEFT_THUMB = 0x0040;
+constexpr uint16_t PAD_BUTTON_RIGHT_THUMB = 0x0080;
+constexpr uint16_t PAD_BUTTON_LEFT_SHOULDER = 0x0100;
+constexpr uint16_t PAD_BUTTON_RIGHT_SHOULDER = 0x0200;
+constexpr uint16_t PAD_BUTTON_CONFIRM = 0x0400;     // CAEgϊゾij
+constexpr uint16_t PAD_BUTTON_CANCEL = 0x0800;      // CAEgϊゾiLZj
+constexpr uint16_t PAD_BUTTON_A = 0x1000;
+constexpr uint16_t PAD_BUTTON_B = 0x2000;
+constexpr uint16_t PAD_BUTTON_X = 0x4000;
+constexpr uint16_t PAD_BUTTON_Y = 0x8000;
+
+// fW^gK[iGetButtons()Ȃ16rbg𒴂}XNŎgj
+constexpr uint32_t PAD_BUTTON_LEFT_TRIGGER = 0x10000;
+constexpr uint32_t PAD_BUTTON_RIGHT_TRIGGER = 0x20000;
+
+//==============================================================================
+// ̃fbh][iXINPUT_GAMEPAD_*_DEADZONE / TRIGGER_THRESHOLDƓlj
+//==============================================================================
+constexpr int16_t PAD_STICK_DEADZONE_LEFT = 7849;
+constexpr int16_t PAD_STICK_DEADZONE_RIGHT = 8689;
+constexpr uint8_t PAD_TRIGGER_THRESHOLD = 30;
+
+// KApplyDeadzoneŒǉ̊
+constexpr float PAD_EXTRA_DEADZONE = 0.15f;
+
+//==============================================================================
+// ̓͒liXINPUT_GAMEPADƓсAL^E̕ۑ`j
+//==============================================================================
+struct RawGamepad {
+    uint16_t buttons = 0;       // PAD_BUTTON_*̃rbgtO
+    uint8_t leftTrigger = 0;    // 0 ~ 255
+    uint8_t rightTrigger = 0;   // 0 ~ 255
+    int16_t thumbLX = 0;        // -32768 ~ 32767
+    int16_t thumbLY = 0;
+    int16_t thumbRX = 0;
+    int16_t thumbRY = 0;
+};
+
+//==============================================================================
+// Lu[Vi̂Ƃ̃XeBbNSEfbh][j
+//==============================================================================
+struct StickCalibration {
+    int16_t centerX = 0;        // ĂƂ̒Sʒui̒lj
+    int16_t centerY = 0;
+    int16_t deadzone = 0;       // S炱̋܂ł0Ƃ݂ȂiƁj
+};
+
+struct GamepadCalibration {
+    StickCalibration leftStick;
+    StickCalibration rightStick;
+    uint8_t leftTriggerThreshold = PAD_TRIGGER_THRESHOLD;
+    uint8_t rightTriggerThreshold = PAD_TRIGGER_THRESHOLD;
+    float extraDeadzone = PAD_EXTRA_DEADZONE;   // Kɒǉfbh][
+
+    GamepadCalibration() {
+        leftStick.deadzone = PAD_STICK_DEADZONE_LEFT;
+        rightStick.deadzone = PAD_STICK_DEADZONE_RIGHT;
+    }
+};
+
+//==============================================================================
+// Q[pbhԍ\
+//==============================================================================
+struct GamepadState {
+    // XeBbNi-1.0 ~ 1.0j
+    float leftStickX = 0.0f;
+    float leftStickY = 0.0f;
+
+    // EXeBbNi-1.0 ~ 1.0j
+    float rightStickX = 0.0f;
+    float rightStickY = 0.0f;
+
+    // gK[i0.0 ~ 1.0j
+    float leftTrigger = 0.0f;
+    float rightTrigger = 0.0f;
+
+    // \L[
+    bool dpadUp = false;
+    bool dpadDown = false;
+    bool dpadLeft = false;
+    bool dpadRight = false;
+
+    // C{^iʒux[Xj
+    bool buttonDown = false;   // A
+    bool buttonRight = false;  // B
+    bool buttonLeft = false;   // X
+    bool buttonUp = false;     // Y
+
+    // V_[{^iLB/RBj
+    bool buttonL1 = false;
+    bool buttonR1 = false;
+
+    // gK[{^iLT/RTj- fW^
+    bool buttonL2 = false;
+    bool buttonR2 = false;
+
+    // XeBbN݁iLS/RSj
+    bool buttonL3 = false;
+    bool buttonR3 = false;
+
+    // VXe{^
+    bool buttonStart = false;
+    bool buttonSelect = false;
+
+    // ELZi{^zuɉĉẼ{^Ɠɗj
+    bool buttonConfirm = false;
+    bool buttonCancel = false;
+
+    // ڑ
+    bool connected = false;
+
+    // XeBbN̑傫Epx̃LbVipA[0]E[1]Ej
+    mutable float polarMagnitude[2] = {};
+    mutable float polarAngle[2] = {};
+    mutable uint8_t polarValid = 0;
+
+    // ꂩ̃{^Ă邩
+    bool IsAnyButtonPressed() const {
+        return buttonDown || buttonRight || buttonLeft || buttonUp ||
+            buttonL1 || buttonR1 || buttonL2 || buttonR2 ||
+            buttonL3 || buttonR3 ||
+            buttonStart || buttonSelect ||
+            dpadUp || dpadDown || dpadLeft || dpadRight;
+    }
+
+    // XeBbN̑傫i0.0 ~ AƂ̃fbh][Ǝ΂߂1.0j
+    float GetLeftMagnitude() const { return GetPolarMagnitude(0); }
+    float GetRightMagnitude() const { return GetPolarMagnitude(1); }
+    // XeBbN̊pxiWAAE0ŔvAオ/2A- ~ ΁j
+    float GetLeftAngle() const { return GetPolarAngle(0); }
+    float GetRightAngle() const { return GetPolarAngle(1); }
+
+    // XeBbN̒lĂԁifR[h֐EtB^[͎ŌĂԁj
+    void InvalidatePolar() { polarValid = 0; }
+
+    // fbh][Kp
+    static float ApplyDeadzone(float value, float deadzone = PAD_EXTRA_DEADZONE) {
+        if (std::fabs(value) < deadzone) return 0.0f;
+        float sign = (value > 0) ? 1.0f : -1.0f;
+        return sign * (std::fabs(value) - deadzone) / (1.0f - deadzone);
+    }
+
+private:
+    float GetPolarMagnitude(int stick) const {
+        if ((polarValid & (1 << stick)) == 0) ComputePolar(stick);
+        return polarMagnitude[stick];
+    }
+    float GetPolarAngle(int stick) const {
+        if ((polarValid & (1 << stick)) == 0) ComputePolar(stick);
+        return polarAngle[stick];
+    }
+    void ComputePolar(int stick) const;
+};
+
+//==============================================================================
+// l߂Q[pbhԁi16oCgAfR[hς݂̒l̕ۑ`j
+//==============================================================================
+// XeBbN-32767 ~ 32767AgK[0 ~ 255Ɋۂ߂i덷͂悻1iK̔j
+constexpr uint8_t COMPACT_FLAG_CONNECTED = 0x01;
+
+struct CompactGamepadState {
+    uint32_t buttons = 0;       // PAD_BUTTON_*izuϊAL2/R2PAD_BUTTON_*_TRIGGERj
+    int16_t leftStickX = 0;     // -32767 ~ 32767  -1.0 ~ 1.0
+    int16_t leftStickY = 0;
+    int16_t rightStickX = 0;
+    int16_t rightStickY = 0;
+    uint8_t leftTrigger = 0;    // 0 ~ 255  0.0 ~ 1.0
+    uint8_t rightTrigger = 0;
+    uint8_t flags = 0;          // COMPACT_FLAG_*
+    uint8_t reserved = 0;
+
+    bool IsConnected() const { return (flags & COMPACT_FLAG_CONNECTED) != 0; }
+    bool IsPressed(uint32_t button) const { return (buttons & button) != 0; }
+
+    // float̒liGamepadStateƓ͈́j
+    float GetLeftStickX() const { return leftStickX * STICK_SCALE; }
+    float GetLeftStickY() const { return leftStickY * STICK_SCALE; }
+    float GetRightStickX() const { return rightStickX * STICK_SCALE; }
+    float GetRightStickY() const { return rightStickY * STICK_SCALE; }
+    float GetLeftTrigger() const { return leftTrigger * TRIGGER_SCALE; }
+    float GetRightTrigger() const { return rightTrigger * TRIGGER_SCALE; }
+
+private:
+    static constexpr float STICK_SCALE = 1.0f / 32767.0f;
+    static constexpr float TRIGGER_SCALE = 1.0f / 255.0f;
+};
+static_assert(sizeof(CompactGamepadState) == 16, "CompactGamepadState must stay 16 bytes");
+
+// GamepadStatel߂E߂i߂Ԃ̑傫Epx̃LbV͋j
+void PackGamepadState(const GamepadState& state, CompactGamepadState* pCompact);
+void UnpackGamepadState(const CompactGamepadState& compact, GamepadState* pState);
+
+// pxiߎAGAMEPAD_EXACT_POLARȂstd::atan2j
+float StickAtan2(float y, float x);
+
+//==============================================================================
+// KifR[h̓Ŗt[ĂԂ̂ŃCCj
+//==============================================================================
+// XeBbNlifbh][0AO-1.0 ~ 1.0ցj
+inline float NormalizeStickValue(int32_t value, int16_t deadzone) {
+    if (value < 0) {
+        if (value > -deadzone) return 0.0f;
+    } else {
+        if (value < deadzone) return 0.0f;
+    }
+
+    constexpr float MAX_VALUE = 32767.0f;
+    float normalizedValue;
+
+    if (value > 0) {
+        normalizedValue = static_cast<float>(value - deadzone) / (MAX_VALUE - deadzone);
+    } else {
+        normalizedValue = static_cast<float>(value + deadzone) / (MAX_VALUE - deadzone);
+    }
+
+    if (normalizedValue < -1.0f) return -1.0f;
+    if (normalizedValue > 1.0f) return 1.0f;
+    return normalizedValue;
+}
+
+// gK[li臒l0Aȏ0.0 ~ 1.0ցj
+inline float NormalizeTriggerValue(uint8_t value, uint8_t threshold) {
+    if (value < threshold) {
+        return 0.0f;
+    }
+
+    constexpr float MAX_VALUE = 255.0f;
+    float normalizedValue = static_cast<float>(value - threshold) / (MAX_VALUE - threshold);
+    return (normalizedValue < 1.0f) ? normalizedValue : 1.0f;
+}
+
+// XeBbNƂ̃fbh][ŃfR[hiŜĂ琳Kj
+inline void DecodeAxialSticks(const RawGamepad& raw, const GamepadCalibration& calibration, GamepadState* pState) {
+    const StickCalibration& left = calibration.leftStick;
+    const StickCalibration& right = calibration.rightStick;
+    float rawLeftX = NormalizeStickValue(raw.thumbLX - left.centerX, left.deadzone);
+    float rawLeftY = NormalizeStickValue(raw.thumbLY - left.centerY, left.deadzone);
+    float rawRightX = NormalizeStickValue(raw.thumbRX - right.centerX, right.deadzone);
+    float rawRightY = NormalizeStickValue(raw.thumbRY - right.centerY, right.deadzone);
+
+    float extra = calibration.extraDeadzone;
+    pState->leftStickX = GamepadState::ApplyDeadzone(rawLeftX, extra);
+    pState->leftStickY = GamepadState::ApplyDeadzone(-rawLeftY, extra);
+    pState->rightStickX = GamepadState::ApplyDeadzone(rawRightX, extra);
+    pState->rightStickY = GamepadState::ApplyDeadzone(-rawRightY, extra);
+    pState->InvalidatePolar();
+}
+
+//==============================================================================
+// fR[h
+//==============================================================================
+// {^EgK[fR[hiXeBbN͂̂܂܁Aconnectedtruej
+void DecodeGamepadButtons(const RawGamepad& raw, const GamepadCalibration& calibration, GamepadState* pState);
+
+// ̓͒lQ[pbhԂifbh][EK݁Aconnectedtruej
+void DecodeGamepad(const RawGamepad& raw, GamepadState* pState);
+// Lu[Vw肵ăfR[h
+void DecodeGamepad(const RawGamepad& raw, const GamepadCalibration& calibration, GamepadState* pState);
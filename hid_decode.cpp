@@ -0,0 +1,60 @@
+/*****************************************************************//**
+ * \file   hid_decode.cpp
+ * \brief  ۑHIDfBXNv^[ƃ|[gfR[hĕ\
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "hid_decode.h"
+#include <cstdio>
+#include <cstring>
+#include "hid_report.h"
+#include "mapped_file.h"
+
+//==============================================================================
+// fR[h[h
+//==============================================================================
+int RunHidDecodeMode(int argc, char* argv[]) {
+    if (argc < 2) {
+        printf("usage: --hid-decode <descriptor.bin> <reports.bin>\n");
+        return 1;
+    }
+
+    MappedFile descriptor;
+    MappedFile reports;
+    if (!descriptor.Open(argv[0]) || !reports.Open(argv[1])) {
+        printf("cannot open %s\n", descriptor.IsOpen() ? argv[1] : argv[0]);
+        return 1;
+    }
+
+    HidReportProgram program;
+    if (!program.Compile(descriptor.GetData(), descriptor.GetSize())) {
+        printf("%s: no gamepad input in descriptor, or it exceeds the report size / op limits\n", argv[0]);
+        return 1;
+    }
+    printf("%zu ops, report id %s\n", program.GetOpCount(), program.UsesReportId() ? "yes" : "no");
+
+    HidInputReport report;
+    HidInputReport prev;
+    const uint8_t* pData = reports.GetData();
+    size_t remaining = reports.GetSize();
+    int index = 0;
+    int decoded = 0;
+    while (remaining > 0) {
+        size_t length = program.GetReportLength(pData, remaining);
+        if (program.Decode(pData, length, &report)) {
+            decoded++;
+            if (memcmp(&report, &prev, sizeof(report)) != 0) {
+                printf("#%-6d btn %04X hid %08X  L(%6d,%6d) R(%6d,%6d)  LT %5u RT %5u\n",
+                    index, report.pad.buttons, report.hidButtons,
+                    report.pad.thumbLX, report.pad.thumbLY, report.pad.thumbRX, report.pad.thumbRY,
+                    report.leftTrigger16, report.rightTrigger16);
+                prev = report;
+            }
+        }
+        pData += length;
+        remaining -= length;
+        index++;
+    }
+    printf("%d reports, %d decoded\n", index, decoded);
+    return 0;
+}
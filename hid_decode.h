@@ -0,0 +1,13 @@
+/*****************************************************************//**
+ * \file   hid_decode.h
+ * \brief  ۑHIDfBXNv^[ƃ|[gfR[hĕ\
+ *
+ * @ȂĂt@CHidReportProgram̌ʂm߂邽߂̂́B
+ * WindowsŁimain.cppjLinuxŁilinux_main.cppj--hid-decodeŋʁB
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+
+// ω|[g\i<descriptor.bin> <reports.bin>As1Ԃj
+int RunHidDecodeMode(int argc, char* argv[]);
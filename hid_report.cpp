@@ -0,0 +1,467 @@
+/*****************************************************************//**
+ * \file   hid_report.cpp
+ * \brief  HID|[gfBXNv^[̉͂Ɠ̓|[g̃fR[h
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "hid_report.h"
+#include <algorithm>
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // gp@y[W
+    constexpr uint16_t PAGE_GENERIC_DESKTOP = 0x01;
+    constexpr uint16_t PAGE_SIMULATION = 0x02;
+    constexpr uint16_t PAGE_BUTTON = 0x09;
+
+    // Generic Desktop̎gp@
+    constexpr uint16_t USAGE_JOYSTICK = 0x04;
+    constexpr uint16_t USAGE_GAMEPAD = 0x05;
+    constexpr uint16_t USAGE_MULTI_AXIS = 0x08;
+    constexpr uint16_t USAGE_X = 0x30;
+    constexpr uint16_t USAGE_RZ = 0x35;
+    constexpr uint16_t USAGE_HAT_SWITCH = 0x39;
+
+    // Simulation Controls̎gp@iBluetoothڑXboxRg[[̃gK[j
+    constexpr uint16_t USAGE_ACCELERATOR = 0xC4;
+    constexpr uint16_t USAGE_BRAKE = 0xC5;
+
+    // ڂ̎ށi^OƎނ̏6rbgj
+    constexpr uint8_t ITEM_INPUT = 0x80;
+    constexpr uint8_t ITEM_COLLECTION = 0xA0;
+    constexpr uint8_t ITEM_END_COLLECTION = 0xC0;
+    constexpr uint8_t ITEM_USAGE_PAGE = 0x04;
+    constexpr uint8_t ITEM_LOGICAL_MIN = 0x14;
+    constexpr uint8_t ITEM_LOGICAL_MAX = 0x24;
+    constexpr uint8_t ITEM_REPORT_SIZE = 0x74;
+    constexpr uint8_t ITEM_REPORT_ID = 0x84;
+    constexpr uint8_t ITEM_REPORT_COUNT = 0x94;
+    constexpr uint8_t ITEM_PUSH = 0xA4;
+    constexpr uint8_t ITEM_POP = 0xB4;
+    constexpr uint8_t ITEM_USAGE = 0x08;
+    constexpr uint8_t ITEM_USAGE_MIN = 0x18;
+    constexpr uint8_t ITEM_USAGE_MAX = 0x28;
+    constexpr uint8_t ITEM_LONG = 0xFE;
+
+    // Inputڂ̃tO
+    constexpr uint32_t INPUT_CONSTANT = 0x01;
+    constexpr uint32_t INPUT_VARIABLE = 0x02;
+
+    // RNV̎
+    constexpr uint32_t COLLECTION_APPLICATION = 0x01;
+
+    // Push/Pop̐[
+    constexpr int MAX_GLOBAL_STACK = 4;
+
+    // 1̓̓|[g̒̏i|[gIDjƖߐ̏
+    // fBXNv^[̓t@Cǂނ̂ŁAꂽlŉXƉmۂ肵Ȃ悤ɂ
+    constexpr uint64_t MAX_REPORT_BITS = 8192 * 8;
+    constexpr size_t MAX_OPS = 1024;
+
+    // nbgXCb`8iォ玞vj
+    const uint16_t HAT_DPAD[8] = {
+        PAD_BUTTON_DPAD_UP,
+        PAD_BUTTON_DPAD_UP | PAD_BUTTON_DPAD_RIGHT,
+        PAD_BUTTON_DPAD_RIGHT,
+        PAD_BUTTON_DPAD_DOWN | PAD_BUTTON_DPAD_RIGHT,
+        PAD_BUTTON_DPAD_DOWN,
+        PAD_BUTTON_DPAD_DOWN | PAD_BUTTON_DPAD_LEFT,
+        PAD_BUTTON_DPAD_LEFT,
+        PAD_BUTTON_DPAD_UP | PAD_BUTTON_DPAD_LEFT,
+    };
+
+    constexpr uint16_t DPAD_MASK = PAD_BUTTON_DPAD_UP | PAD_BUTTON_DPAD_DOWN |
+        PAD_BUTTON_DPAD_LEFT | PAD_BUTTON_DPAD_RIGHT;
+
+    // O[oڂ̏ԁiPush/Popőޔj
+    struct GlobalState {
+        uint16_t usagePage = 0;
+        int32_t logicalMin = 0;
+        int32_t logicalMax = 0;
+        uint32_t reportSize = 0;
+        uint32_t reportCount = 0;
+        uint8_t reportId = 0;
+    };
+
+    // Nv֐iOj
+    template<typename T>
+    T Clamp(T value, T minVal, T maxVal) {
+        if (value < minVal) return minVal;
+        if (value > maxVal) return maxVal;
+        return value;
+    }
+
+    // ŏliOj
+    template<typename T>
+    T Min(T a, T b) {
+        return (a < b) ? a : b;
+    }
+
+    // ڂ̃f[^igGfBAAtœǂނǂj
+    uint32_t ReadItemData(const uint8_t* pData, int size) {
+        uint32_t value = 0;
+        for (int i = 0; i < size; i++) {
+            value |= static_cast<uint32_t>(pData[i]) << (8 * i);
+        }
+        return value;
+    }
+
+    int32_t ReadItemDataSigned(const uint8_t* pData, int size) {
+        uint32_t value = ReadItemData(pData, size);
+        if (size == 1) return static_cast<int8_t>(value);
+        if (size == 2) return static_cast<int16_t>(value);
+        return static_cast<int32_t>(value);
+    }
+
+    // |[grbgoi͈͂Compile32rbgȉɐς݁j
+    inline uint32_t ExtractBits(const uint8_t* pData, uint32_t bitOffset, int bitCount) {
+        const uint8_t* p = pData + (bitOffset >> 3);
+        int shift = static_cast<int>(bitOffset & 7);
+        int byteCount = (shift + bitCount + 7) >> 3;
+        uint64_t word = 0;
+        for (int i = 0; i < byteCount; i++) {
+            word |= static_cast<uint64_t>(p[i]) << (8 * i);
+        }
+        uint64_t mask = (bitCount >= 32) ? 0xFFFFFFFFull : ((1ull << bitCount) - 1);
+        return static_cast<uint32_t>((word >> shift) & mask);
+    }
+}
+
+//==============================================================================
+// ̊蓖āiDualShock 4 / DualSensej
+//==============================================================================
+HidMapping::HidMapping() {
+    axes[0] = HID_AXIS_LEFT_X;          // X
+    axes[1] = HID_AXIS_LEFT_Y;          // Y
+    axes[2] = HID_AXIS_RIGHT_X;         // Z
+    axes[3] = HID_AXIS_LEFT_TRIGGER;    // Rx
+    axes[4] = HID_AXIS_RIGHT_TRIGGER;   // Ry
+    axes[5] = HID_AXIS_RIGHT_Y;         // Rz
+
+    for (uint16_t& button : buttons) {
+        button = 0;
+    }
+    buttons[0] = PAD_BUTTON_X;              // 
+    buttons[1] = PAD_BUTTON_A;              // ~
+    buttons[2] = PAD_BUTTON_B;              // 
+    buttons[3] = PAD_BUTTON_Y;              // 
+    buttons[4] = PAD_BUTTON_LEFT_SHOULDER;  // L1
+    buttons[5] = PAD_BUTTON_RIGHT_SHOULDER; // R1
+    // 7, 8ԁiL2/R2̃fW^j̓AiÕgK[Ŕ肷̂Ŋ蓖ĂȂ
+    buttons[8] = PAD_BUTTON_BACK;           // SHARE / Create
+    buttons[9] = PAD_BUTTON_START;          // OPTIONS
+    buttons[10] = PAD_BUTTON_LEFT_THUMB;    // L3
+    buttons[11] = PAD_BUTTON_RIGHT_THUMB;   // R3
+}
+
+//==============================================================================
+// fBXNv^[̉
+//==============================================================================
+bool HidReportProgram::Compile(const uint8_t* pDescriptor, size_t size, const HidMapping& mapping) {
+    struct PendingOp {
+        uint8_t reportId;
+        Op op;
+    };
+    std::vector<PendingOp> pending;
+
+    m_ops.clear();
+    for (Range& range : m_ranges) {
+        range = {};
+    }
+    for (uint16_t& reportSize : m_reportSize) {
+        reportSize = 0;
+    }
+    m_usesReportId = false;
+
+    GlobalState global;
+    GlobalState stack[MAX_GLOBAL_STACK];
+    int stackDepth = 0;
+
+    // [JځiMainڂƂɃNAj
+    std::vector<uint32_t> usages;
+    uint32_t usageMin = 0;
+    uint32_t usageMax = 0;
+    bool hasUsageRange = false;
+
+    // Q[pbhEWCXeBbÑAvP[VRNV̒
+    int collectionDepth = 0;
+    int gamepadDepth = 0;
+
+    // |[gIDƂ̓͂̃rbg
+    uint32_t bitOffset[256] = {};
+
+    size_t pos = 0;
+    while (pos < size) {
+        uint8_t prefix = pDescriptor[pos++];
+        if (prefix == ITEM_LONG) {
+            // ڂ͎gȂ̂Ŕ΂if[^E^OEf[^j
+            if (pos >= size) break;
+            pos += 2 + pDescriptor[pos];
+            continue;
+        }
+
+        static const int DATA_SIZES[4] = { 0, 1, 2, 4 };
+        int dataSize = DATA_SIZES[prefix & 0x03];
+        if (pos + dataSize > size) break;
+        const uint8_t* pData = pDescriptor + pos;
+        pos += dataSize;
+
+        uint8_t item = prefix & 0xFC;
+        uint32_t value = ReadItemData(pData, dataSize);
+
+        // gp@4oCgȂy[W݁AȊO݂͌̃y[Wt
+        uint32_t fullUsage = (dataSize == 4) ? value : ((static_cast<uint32_t>(global.usagePage) << 16) | value);
+
+        switch (item) {
+        case ITEM_USAGE_PAGE: global.usagePage = static_cast<uint16_t>(value); break;
+        case ITEM_LOGICAL_MIN: global.logicalMin = ReadItemDataSigned(pData, dataSize); break;
+        case ITEM_LOGICAL_MAX: global.logicalMax = ReadItemDataSigned(pData, dataSize); break;
+        case ITEM_REPORT_SIZE: global.reportSize = value; break;
+        case ITEM_REPORT_COUNT: global.reportCount = value; break;
+        case ITEM_REPORT_ID:
+            global.reportId = static_cast<uint8_t>(value);
+            m_usesReportId = true;
+            break;
+        case ITEM_PUSH:
+            if (stackDepth < MAX_GLOBAL_STACK) stack[stackDepth++] = global;
+            break;
+        case ITEM_POP:
+            if (stackDepth > 0) global = stack[--stackDepth];
+            break;
+        case ITEM_USAGE: usages.push_back(fullUsage); break;
+        case ITEM_USAGE_MIN: usageMin = fullUsage; hasUsageRange = true; break;
+        case ITEM_USAGE_MAX: usageMax = fullUsage; hasUsageRange = true; break;
+
+        case ITEM_COLLECTION:
+            collectionDepth++;
+            if (gamepadDepth == 0 && value == COLLECTION_APPLICATION && !usages.empty()) {
+                uint32_t usage = usages[0];
+                uint16_t page = static_cast<uint16_t>(usage >> 16);
+                uint16_t id = static_cast<uint16_t>(usage & 0xFFFF);
+                if (page == PAGE_GENERIC_DESKTOP &&
+                    (id == USAGE_GAMEPAD || id == USAGE_JOYSTICK || id == USAGE_MULTI_AXIS)) {
+                    gamepadDepth = collectionDepth;
+                }
+            }
+            usages.clear();
+            hasUsageRange = false;
+            break;
+
+        case ITEM_END_COLLECTION:
+            if (collectionDepth == gamepadDepth) gamepadDepth = 0;
+            if (collectionDepth > 0) collectionDepth--;
+            usages.clear();
+            hasUsageRange = false;
+            break;
+
+        case ITEM_INPUT: {
+            uint32_t& offset = bitOffset[global.reportId];
+            uint32_t fieldSize = global.reportSize;
+
+            // 萔ipfBOjƔz`AQ[pbhȊÕRNV͈ʒu܂Ƃ߂Đi߂
+            bool usable = gamepadDepth != 0 && (value & INPUT_CONSTANT) == 0 &&
+                (value & INPUT_VARIABLE) != 0 && fieldSize >= 1 && fieldSize <= 32;
+
+            // |[g̒̏𒴂̂̓fBXNv^[Ǝ󂯕tȂ
+            uint64_t fieldBits = static_cast<uint64_t>(fieldSize) * global.reportCount;
+            if (offset + fieldBits > MAX_REPORT_BITS) {
+                return false;
+            }
+            if (!usable) {
+                offset += static_cast<uint32_t>(fieldBits);
+                usages.clear();
+                hasUsageRange = false;
+                break;
+            }
+
+            // ŏltōőlɂȂ̂́AȂŏ̂Ƃ݂Ȃ
+            int32_t logicalMin = global.logicalMin;
+            int32_t logicalMax = global.logicalMax;
+            if (logicalMin >= 0 && logicalMax < logicalMin) {
+                logicalMax = static_cast<int32_t>(fieldSize >= 32 ? 0x7FFFFFFF : ((1u << fieldSize) - 1));
+            }
+
+            for (uint32_t i = 0; i < global.reportCount; i++, offset += fieldSize) {
+                uint32_t usage;
+                if (i < usages.size()) {
+                    usage = usages[i];
+                } else if (hasUsageRange) {
+                    usage = Min(usageMin + (i - static_cast<uint32_t>(usages.size())), usageMax);
+                } else if (!usages.empty()) {
+                    usage = usages.back();
+                } else {
+                    continue;
+                }
+                uint16_t page = static_cast<uint16_t>(usage >> 16);
+                uint16_t id = static_cast<uint16_t>(usage & 0xFFFF);
+
+                Op op = {};
+                op.bitOffset = offset;
+                op.bitSize = static_cast<uint8_t>(fieldSize);
+                op.isSigned = logicalMin < 0;
+                op.logicalMin = logicalMin;
+                op.logicalMax = logicalMax;
+
+                if (page == PAGE_BUTTON && fieldSize == 1 && id >= 1 && id <= 32) {
+                    // O̖߂ƈʒuԍĂ1ɂ܂Ƃ߂
+                    if (!pending.empty()) {
+                        PendingOp& last = pending.back();
+                        if (last.reportId == global.reportId && last.op.type == OP_BUTTONS &&
+                            last.op.bitOffset + last.op.bitSize == offset &&
+                            last.op.target + last.op.bitSize == id - 1 && last.op.bitSize < 32) {
+                            last.op.bitSize++;
+                            continue;
+                        }
+                    }
+                    op.type = OP_BUTTONS;
+                    op.target = static_cast<uint8_t>(id - 1);
+                    op.isSigned = 0;
+                } else if (page == PAGE_GENERIC_DESKTOP && id >= USAGE_X && id <= USAGE_RZ) {
+                    op.type = OP_AXIS;
+                    op.target = mapping.axes[id - USAGE_X];
+                    if (op.target == HID_AXIS_NONE) continue;
+                } else if (page == PAGE_GENERIC_DESKTOP && id == USAGE_HAT_SWITCH) {
+                    op.type = OP_HAT;
+                } else if (page == PAGE_SIMULATION && (id == USAGE_ACCELERATOR || id == USAGE_BRAKE)) {
+                    op.type = OP_AXIS;
+                    op.target = (id == USAGE_ACCELERATOR) ? HID_AXIS_RIGHT_TRIGGER : HID_AXIS_LEFT_TRIGGER;
+                } else {
+                    continue;
+                }
+                if (op.type != OP_BUTTONS && op.logicalMax <= op.logicalMin) continue;
+                if (pending.size() >= MAX_OPS) {
+                    return false;
+                }
+                pending.push_back({ global.reportId, op });
+            }
+            usages.clear();
+            hasUsageRange = false;
+            break;
+        }
+
+        default:
+            // OutputEFeatureȂǂ̃Cڂ[Jڂ
+            if ((prefix & 0x0C) == 0x00) {
+                usages.clear();
+                hasUsageRange = false;
+            }
+            break;
+        }
+    }
+
+    // |[gIDƂɕׂĔ͈͂L^
+    std::stable_sort(pending.begin(), pending.end(),
+        [](const PendingOp& a, const PendingOp& b) { return a.reportId < b.reportId; });
+    for (const PendingOp& p : pending) {
+        Range& range = m_ranges[p.reportId];
+        if (range.count == 0) range.first = static_cast<uint16_t>(m_ops.size());
+        range.count++;
+        m_ops.push_back(p.op);
+    }
+    for (int id = 0; id < 256; id++) {
+        if (bitOffset[id] > 0) {
+            m_reportSize[id] = static_cast<uint16_t>((bitOffset[id] + 7) / 8 + (m_usesReportId ? 1 : 0));
+        }
+    }
+
+    // {^ԍPAD_BUTTON_*ւ̕\
+    for (int table = 0; table < 4; table++) {
+        for (int bits = 0; bits < 256; bits++) {
+            uint16_t buttons = 0;
+            for (int j = 0; j < 8; j++) {
+                if (bits & (1 << j)) buttons |= mapping.buttons[table * 8 + j];
+            }
+            m_buttonTable[table][bits] = buttons;
+        }
+    }
+
+    return !m_ops.empty();
+}
+
+//==============================================================================
+// A|[g̋؂
+//==============================================================================
+size_t HidReportProgram::GetReportLength(const uint8_t* pData, size_t size) const {
+    if (size == 0) {
+        return 0;
+    }
+    size_t length = m_reportSize[m_usesReportId ? pData[0] : 0];
+    // `̂ȂIDrŐ؂ꂽ͎̂cS1Ƃ݂Ȃ
+    return (length == 0 || length > size) ? size : length;
+}
+
+//==============================================================================
+// ̓|[g̃fR[h
+//==============================================================================
+bool HidReportProgram::Decode(const uint8_t* pReport, size_t size, HidInputReport* pOut) const {
+    uint8_t reportId = 0;
+    if (m_usesReportId) {
+        if (size < 1) return false;
+        reportId = pReport[0];
+        pReport++;
+        size--;
+    }
+    const Range& range = m_ranges[reportId];
+    if (range.count == 0) {
+        return false;
+    }
+
+    uint64_t reportBits = static_cast<uint64_t>(size) * 8;
+    uint16_t dpad = pOut->pad.buttons & DPAD_MASK;
+    const Op* pOp = m_ops.data() + range.first;
+    for (int i = 0; i < range.count; i++, pOp++) {
+        // Z|[girŐ؂ꂽ́j͓Ă镪
+        if (pOp->bitOffset + pOp->bitSize > reportBits) continue;
+        uint32_t raw = ExtractBits(pReport, pOp->bitOffset, pOp->bitSize);
+
+        if (pOp->type == OP_BUTTONS) {
+            uint32_t fieldMask = (pOp->bitSize >= 32) ? 0xFFFFFFFFu : ((1u << pOp->bitSize) - 1);
+            pOut->hidButtons = (pOut->hidButtons & ~(fieldMask << pOp->target)) | (raw << pOp->target);
+            continue;
+        }
+
+        int32_t value = static_cast<int32_t>(raw);
+        if (pOp->isSigned && pOp->bitSize < 32 && (raw & (1u << (pOp->bitSize - 1)))) {
+            value = static_cast<int32_t>(raw | ~((1u << pOp->bitSize) - 1));
+        }
+
+        if (pOp->type == OP_HAT) {
+            // ͈͊O̓j[gi4̃nbg8ɍLj
+            int32_t positions = pOp->logicalMax - pOp->logicalMin + 1;
+            if (value < pOp->logicalMin || value > pOp->logicalMax) {
+                dpad = 0;
+            } else {
+                dpad = HAT_DPAD[(value - pOp->logicalMin) * 8 / positions];
+            }
+            continue;
+        }
+
+        // _͈͂0 ~ 65535
+        int64_t range64 = static_cast<int64_t>(pOp->logicalMax) - pOp->logicalMin;
+        int64_t clamped = Clamp<int64_t>(value, pOp->logicalMin, pOp->logicalMax) - pOp->logicalMin;
+        int32_t unit = static_cast<int32_t>(clamped * 65535 / range64);
+        switch (pOp->target) {
+        case HID_AXIS_LEFT_X: pOut->pad.thumbLX = static_cast<int16_t>(unit - 32768); break;
+        case HID_AXIS_RIGHT_X: pOut->pad.thumbRX = static_cast<int16_t>(unit - 32768); break;
+        // HIDY͉AXInput͏オ
+        case HID_AXIS_LEFT_Y: pOut->pad.thumbLY = static_cast<int16_t>(32767 - unit); break;
+        case HID_AXIS_RIGHT_Y: pOut->pad.thumbRY = static_cast<int16_t>(32767 - unit); break;
+        case HID_AXIS_LEFT_TRIGGER:
+            pOut->leftTrigger16 = static_cast<uint16_t>(unit);
+            pOut->pad.leftTrigger = static_cast<uint8_t>(unit >> 8);
+            break;
+        case HID_AXIS_RIGHT_TRIGGER:
+            pOut->rightTrigger16 = static_cast<uint16_t>(unit);
+            pOut->pad.rightTrigger = static_cast<uint8_t>(unit >> 8);
+            break;
+        }
+    }
+
+    uint32_t hid = pOut->hidButtons;
+    pOut->pad.buttons = static_cast<uint16_t>(dpad |
+        m_buttonTable[0][hid & 0xFF] | m_buttonTable[1][(hid >> 8) & 0xFF] |
+        m_buttonTable[2][(hid >> 16) & 0xFF] | m_buttonTable[3][hid >> 24]);
+    return true;
+}
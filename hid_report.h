@@ -0,0 +1,110 @@
+/*****************************************************************//**
+ * \file   hid_report.h
+ * \brief  HID|[gfBXNv^[̉͂Ɠ̓|[g̃fR[h
+ *
+ * fBXNv^[͊JƂɈx͂AQ[pbhƂĎg
+ * tB[huǂ̃rbg牽rbgoĂǂ֓邩v
+ * ߂̕тɂ܂Ƃ߂B̓|[g̖͂߂𓪂s邾ŁA
+ * Mobt@璼ڃrbgoiRs[̑͂ȂjB
+ *
+ * o͂XInputƓڐRawGamepadȂ̂ŁALu[VE
+ * {^zuEL^̌oH͂̂܂܎gBXInput̖ڐɎ܂Ȃ
+ * i17Ԗڈȍ~̃{^A8rbg𒴂gK[j͕ʂɎcB
+ *
+ * fBXNv^[|[goCgnȂ̂ŁA@ȂĂ
+ * ۑt@CfR[hm߂imain.cpp--hid-decodejB
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "gamepad_state.h"
+
+//==============================================================================
+// fR[h
+//==============================================================================
+struct HidInputReport {
+    RawGamepad pad;                 // XInputƓڐ̒l
+    uint32_t hidButtons = 0;        // HID̃{^ԍ1 ~ 32̂܂܃rbg0 ~ 31
+    uint16_t leftTrigger16 = 0;     // gK[̌̕\ۂli0 ~ 65535j
+    uint16_t rightTrigger16 = 0;
+};
+
+//==============================================================================
+// 蓖āiHID̎E{^Q[pbĥǂɓ邩j
+//==============================================================================
+enum HidAxisTarget : uint8_t {
+    HID_AXIS_NONE = 0,
+    HID_AXIS_LEFT_X,
+    HID_AXIS_LEFT_Y,
+    HID_AXIS_RIGHT_X,
+    HID_AXIS_RIGHT_Y,
+    HID_AXIS_LEFT_TRIGGER,
+    HID_AXIS_RIGHT_TRIGGER,
+};
+
+struct HidMapping {
+    // Generic Desktop X, Y, Z, Rx, Ry, Rzigp@0x30 ~ 0x35j̊蓖
+    HidAxisTarget axes[6];
+    // HID̃{^ԍ1 ~ 32ɑΉPAD_BUTTON_*i0Ȃ犄蓖ĂȂj
+    uint16_t buttons[32];
+
+    // DualShock 4 / DualSense̕сiX,YAZ,RzEARx,RygK[j
+    HidMapping();
+};
+
+//==============================================================================
+// ̓|[g̃fR[h
+//==============================================================================
+class HidReportProgram {
+public:
+    // fBXNv^[͂Ė߂iQ[pbh̓͂ȂE|[gE߂Ȃfalsej
+    bool Compile(const uint8_t* pDescriptor, size_t size, const HidMapping& mapping = HidMapping());
+
+    bool IsValid() const { return !m_ops.empty(); }
+    // |[g̐擪1oCg|[gID
+    bool UsesReportId() const { return m_usesReportId; }
+    // |[gIDƂ̓̓|[g̒iID܂ށA`Ȃ0j
+    size_t GetReportSize(uint8_t reportId) const { return m_reportSize[reportId]; }
+    // ߐ
+    size_t GetOpCount() const { return m_ops.size(); }
+
+    // Aĕ񂾃|[gipCvL^t@Cj̐擪1̒
+    size_t GetReportLength(const uint8_t* pData, size_t size) const;
+
+    // ̓|[g1fR[hiQ[pbh̃|[głȂfalseŉȂj
+    // pOut͑O̒lc܂܁Ã|[gɊ܂܂tB[h
+    bool Decode(const uint8_t* pReport, size_t size, HidInputReport* pOut) const;
+
+private:
+    enum OpType : uint8_t {
+        OP_BUTTONS,         // A{^܂Ƃ߂hidButtons
+        OP_AXIS,            // itargetɊ蓖āj
+        OP_HAT,             // nbgXCb`\L[
+    };
+
+    struct Op {
+        uint32_t bitOffset;     // |[gID擪̃rbgʒu
+        uint8_t bitSize;
+        OpType type;
+        uint8_t target;         // OP_AXIS: HidAxisTarget / OP_BUTTONS: ŏ̃{^ԍ-1
+        uint8_t isSigned;
+        int32_t logicalMin;
+        int32_t logicalMax;
+    };
+
+    struct Range {
+        uint16_t first;
+        uint16_t count;
+    };
+
+    std::vector<Op> m_ops;          // |[gID
+    Range m_ranges[256] = {};       // |[gIDƂ̖߂͈̔
+    uint16_t m_reportSize[256] = {};
+    bool m_usesReportId = false;
+
+    // hidButtonsPAD_BUTTON_*֕ϊ\i8rbg4j
+    uint16_t m_buttonTable[4][256] = {};
+};
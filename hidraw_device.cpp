@@ -0,0 +1,140 @@
+/*****************************************************************//**
+ * \file   hidraw_device.cpp
+ * \brief  LinuxhidrawfoCX̓́ievdevʂHID|[g𒼐ړǂށj
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "hidraw_device.h"
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <linux/hidraw.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // TfoCXԍ̏
+    constexpr int MAX_HIDRAW_DEVICES = 64;
+}
+
+//==============================================================================
+// J
+//==============================================================================
+bool HidrawDevice::Open(const char* pPath, const HidMapping& mapping) {
+    Close();
+
+    int fd = open(pPath, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    int descriptorSize = 0;
+    hidraw_report_descriptor descriptor = {};
+    if (ioctl(fd, HIDIOCGRDESCSIZE, &descriptorSize) < 0 ||
+        descriptorSize <= 0 || descriptorSize > HID_MAX_DESCRIPTOR_SIZE) {
+        close(fd);
+        return false;
+    }
+    descriptor.size = static_cast<uint32_t>(descriptorSize);
+    if (ioctl(fd, HIDIOCGRDESC, &descriptor) < 0) {
+        close(fd);
+        return false;
+    }
+
+    if (!Attach(fd, descriptor.value, descriptor.size, mapping)) {
+        return false;
+    }
+    return true;
+}
+
+bool HidrawDevice::Attach(int fd, const uint8_t* pDescriptor, size_t size, const HidMapping& mapping) {
+    Close();
+    if (!m_program.Compile(pDescriptor, size, mapping)) {
+        close(fd);
+        return false;
+    }
+    m_fd = fd;
+    m_report = HidInputReport();
+    m_reportCount = 0;
+    return true;
+}
+
+void HidrawDevice::Close() {
+    if (m_fd >= 0) {
+        close(m_fd);
+        m_fd = -1;
+    }
+}
+
+//==============================================================================
+// ǂݍ
+//==============================================================================
+int HidrawDevice::Poll() {
+    uint8_t buffer[READ_BUFFER_SIZE];
+    return Drain(buffer, sizeof(buffer));
+}
+
+int HidrawDevice::Drain(uint8_t* pBuffer, size_t bufferSize) {
+    if (m_fd < 0) {
+        return -1;
+    }
+
+    int decoded = 0;
+    for (;;) {
+        ssize_t length = read(m_fd, pBuffer, bufferSize);
+        if (length > 0) {
+            decoded += Consume(pBuffer, static_cast<size_t>(length));
+            continue;
+        }
+        if (length < 0 && errno == EINTR) {
+            continue;
+        }
+        if (length < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return decoded;
+        }
+        // 0iݑjȊÕG[͐ؒf
+        Close();
+        return -1;
+    }
+}
+
+int HidrawDevice::Consume(const uint8_t* pData, size_t size) {
+    // hidraw1read()1|[gApCvł͑ē͂̂ŋ؂ȂfR[h
+    int decoded = 0;
+    while (size > 0) {
+        size_t length = m_program.GetReportLength(pData, size);
+        if (m_program.Decode(pData, length, &m_report)) {
+            decoded++;
+        }
+        pData += length;
+        size -= length;
+    }
+    m_reportCount += decoded;
+    return decoded;
+}
+
+//==============================================================================
+// Q[pbh̗
+//==============================================================================
+int EnumerateHidrawGamepads(HidrawDeviceCallback pCallback, void* pContext) {
+    int count = 0;
+    char path[32];
+    for (int i = 0; i < MAX_HIDRAW_DEVICES; i++) {
+        snprintf(path, sizeof(path), "/dev/hidraw%d", i);
+        HidrawDevice device;
+        if (!device.Open(path)) {
+            continue;
+        }
+        device.Close();
+        pCallback(path, pContext);
+        count++;
+    }
+    return count;
+}
+
+#endif // __linux__
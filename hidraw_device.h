@@ -0,0 +1,65 @@
+/*****************************************************************//**
+ * \file   hidraw_device.h
+ * \brief  LinuxhidrawfoCX̓́ievdevʂHID|[g𒼐ړǂށj
+ *
+ * JƂɃ|[gfBXNv^[擾ăfR[h߂A
+ * ȍ~͓ǂ񂾃|[g𖽗߂ɒʂɂBevdevł͗Ă܂
+ * g{^gK[̕\HidInputReportɎcB
+ *
+ * Attach()͔Cӂ̃t@CfBXNv^[ƃfBXNv^[̃oCg
+ * ̂ŁApCvۑf[^Ŏ@ȂɓB
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#ifdef __linux__
+#include <cstddef>
+#include <cstdint>
+#include "hid_report.h"
+
+//==============================================================================
+// hidrawfoCXNX
+//==============================================================================
+class HidrawDevice {
+public:
+    // 1read()œǂޏ
+    static constexpr size_t READ_BUFFER_SIZE = 4096;
+
+    HidrawDevice() = default;
+    ~HidrawDevice() { Close(); }
+    HidrawDevice(const HidrawDevice&) = delete;
+    HidrawDevice& operator=(const HidrawDevice&) = delete;
+
+    // /dev/hidrawNJiQ[pbhłȂfalsej
+    bool Open(const char* pPath, const HidMapping& mapping = HidMapping());
+    // JĂfdƃfBXNv^[ŏifd̏L󂯎j
+    bool Attach(int fd, const uint8_t* pDescriptor, size_t size, const HidMapping& mapping = HidMapping());
+    void Close();
+
+    bool IsOpen() const { return m_fd >= 0; }
+    int GetFd() const { return m_fd; }
+
+    // ǂ߂邾ǂŏԂXVifR[h|[gAؒfꂽ-1j
+    int Poll();
+    // Poll()ƓAǂݍ݂ɌĂяõobt@gi傫قread()̉񐔂j
+    int Drain(uint8_t* pBuffer, size_t bufferSize);
+    // ǂݍݍς݂̃oCgi1ȏ̃|[g񂾂́jfR[h
+    int Consume(const uint8_t* pData, size_t size);
+
+    const HidInputReport& GetReport() const { return m_report; }
+    const HidReportProgram& GetProgram() const { return m_program; }
+    // M|[g̑
+    uint64_t GetReportCount() const { return m_reportCount; }
+
+private:
+    int m_fd = -1;
+    HidReportProgram m_program;
+    HidInputReport m_report;
+    uint64_t m_reportCount = 0;
+};
+
+// /dev/hidraw*Q[pbhTpCallbackɓniԂj
+typedef void(*HidrawDeviceCallback)(const char* pPath, void* pContext);
+int EnumerateHidrawGamepads(HidrawDeviceCallback pCallback, void* pContext);
+
+#endif // __linux__
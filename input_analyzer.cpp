@@ -0,0 +1,497 @@
+/*****************************************************************//**
+ * \file   input_analyzer.cpp
+ * \brief  L^t@CQ̃ItCWvi{^gpEXeBbNzȂǁj
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "input_analyzer.h"
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <new>
+#include <thread>
+#include <vector>
+#include "input_codec.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // 1ɃfR[hTv
+    constexpr size_t BATCH_SAMPLES = 4096;
+
+    // ȑ݂AēꏊɓƑ҂̂ŁA
+    // TvƂɕʂ̕qXgO֐U蕪čŌɍv
+    constexpr int HISTOGRAM_LANES = 4;
+
+    constexpr int HEATMAP_CELLS = ANALYZER_HEATMAP_SIZE * ANALYZER_HEATMAP_SIZE;
+    constexpr int HEATMAP_SHIFT = 11;   // 65536 / 32
+    constexpr int TRIGGER_SHIFT = 3;    // 256 / 32
+
+    // \p
+    const char* const BUTTON_NAMES[ANALYZER_BUTTON_COUNT] = {
+        "UP", "DOWN", "LEFT", "RIGHT", "START", "BACK", "LS", "RS",
+        "LB", "RB", "(10)", "(11)", "A", "B", "X", "Y",
+    };
+    const char SHADE_CHARS[] = " .:-=+*#%@";
+    constexpr int SHADE_LEVELS = sizeof(SHADE_CHARS) - 2;
+    constexpr int HEATMAP_PRINT_SIZE = 16;
+
+    // oߎԁi}CNbjԕz̃rցi0: 1msAn: 2^(n-1)msȏj
+    int DurationBin(uint64_t durationUs) {
+        uint64_t ms = durationUs / 1000;
+        int bin = 0;
+        while (ms != 0 && bin < ANALYZER_DURATION_BINS - 1) {
+            ms >>= 1;
+            bin++;
+        }
+        return bin;
+    }
+
+    // ȑi~bj
+    uint64_t DurationBinLimitMs(int bin) {
+        return static_cast<uint64_t>(1) << bin;
+    }
+
+    // qXgO̕Sʂr
+    int PercentileBin(const uint64_t* pBins, int binCount, double percentile) {
+        uint64_t total = 0;
+        for (int i = 0; i < binCount; i++) {
+            total += pBins[i];
+        }
+        if (total == 0) {
+            return -1;
+        }
+
+        uint64_t target = static_cast<uint64_t>(total * percentile);
+        uint64_t sum = 0;
+        for (int i = 0; i < binCount; i++) {
+            sum += pBins[i];
+            if (sum > target) {
+                return i;
+            }
+        }
+        return binCount - 1;
+    }
+
+    void FormatPercentile(char* pBuf, size_t bufSize, const uint64_t* pBins, double percentile) {
+        int bin = PercentileBin(pBins, ANALYZER_DURATION_BINS, percentile);
+        if (bin < 0) {
+            sprintf_s(pBuf, bufSize, "-");
+        } else {
+            sprintf_s(pBuf, bufSize, "<%llums", static_cast<unsigned long long>(DurationBinLimitMs(bin)));
+        }
+    }
+
+    //==========================================================================
+    // 1t@CWv̍Ɨ̈
+    //==========================================================================
+    struct AnalyzeWork {
+        // fR[h
+        InputSample samples[BATCH_SAMPLES];
+
+        // ڑ̃TvƂɕׂz
+        uint64_t times[BATCH_SAMPLES];
+        uint16_t buttons[BATCH_SAMPLES];
+        uint16_t edges[BATCH_SAMPLES];      // ̃Tvŉꂽrbg
+        int16_t thumbs[4][BATCH_SAMPLES];   // LX, LY, RX, RY
+        uint8_t triggers[2][BATCH_SAMPLES];
+        uint16_t cells[BATCH_SAMPLES];
+
+        // qXgOit@C̏IŏWvʂ֑j
+        uint32_t heatmap[2][HISTOGRAM_LANES][HEATMAP_CELLS];
+        uint32_t trigger[2][HISTOGRAM_LANES][ANALYZER_TRIGGER_BINS];
+
+        // ԁEԂ̒ǐ
+        uint16_t prevButtons;
+        uint64_t pressStart[ANALYZER_BUTTON_COUNT];
+        uint64_t lastPressTime;
+        int lastPressBit;
+    };
+
+    // XeBbN̒lq[g}bṽ}XԍցiY͏オ0j
+    void ComputeHeatmapCells(const int16_t* pX, const int16_t* pY, size_t count, uint16_t* pCells) {
+        for (size_t i = 0; i < count; i++) {
+            uint32_t col = static_cast<uint16_t>(pX[i] ^ 0x8000) >> HEATMAP_SHIFT;
+            uint32_t row = (ANALYZER_HEATMAP_SIZE - 1) - (static_cast<uint16_t>(pY[i] ^ 0x8000) >> HEATMAP_SHIFT);
+            pCells[i] = static_cast<uint16_t>(row * ANALYZER_HEATMAP_SIZE + col);
+        }
+    }
+
+    // qXgO։ZiHISTOGRAM_LANESʂ̃[ցj
+    void AccumulateLanes(const uint16_t* pBins, size_t count, uint32_t (*pLanes)[HEATMAP_CELLS]) {
+        size_t i = 0;
+        for (; i + HISTOGRAM_LANES <= count; i += HISTOGRAM_LANES) {
+            pLanes[0][pBins[i]]++;
+            pLanes[1][pBins[i + 1]]++;
+            pLanes[2][pBins[i + 2]]++;
+            pLanes[3][pBins[i + 3]]++;
+        }
+        for (; i < count; i++) {
+            pLanes[0][pBins[i]]++;
+        }
+    }
+
+    void AccumulateTriggerLanes(const uint8_t* pValues, size_t count, uint32_t (*pLanes)[ANALYZER_TRIGGER_BINS]) {
+        size_t i = 0;
+        for (; i + HISTOGRAM_LANES <= count; i += HISTOGRAM_LANES) {
+            pLanes[0][pValues[i] >> TRIGGER_SHIFT]++;
+            pLanes[1][pValues[i + 1] >> TRIGGER_SHIFT]++;
+            pLanes[2][pValues[i + 2] >> TRIGGER_SHIFT]++;
+            pLanes[3][pValues[i + 3] >> TRIGGER_SHIFT]++;
+        }
+        for (; i < count; i++) {
+            pLanes[0][pValues[i] >> TRIGGER_SHIFT]++;
+        }
+    }
+
+    // rbgƂɗĂTv𐔂
+    void CountBits(const uint16_t* pMasks, size_t count, uint64_t* pCounts) {
+        for (int bit = 0; bit < ANALYZER_BUTTON_COUNT; bit++) {
+            uint32_t sum = 0;
+            for (size_t i = 0; i < count; i++) {
+                sum += (pMasks[i] >> bit) & 1;
+            }
+            pCounts[bit] += sum;
+        }
+    }
+
+    //==========================================================================
+    // 1ob`̏Wv
+    //==========================================================================
+    void AnalyzeBatch(AnalyzeWork* pWork, size_t sampleCount, InputCorpusStats* pStats) {
+        // ڑ̃TvƂ̔zցi򂹂Ăi߂j
+        size_t count = 0;
+        for (size_t i = 0; i < sampleCount; i++) {
+            const InputSample& sample = pWork->samples[i];
+            pWork->times[count] = sample.timeUs;
+            pWork->buttons[count] = sample.pad.buttons;
+            pWork->thumbs[0][count] = sample.pad.thumbLX;
+            pWork->thumbs[1][count] = sample.pad.thumbLY;
+            pWork->thumbs[2][count] = sample.pad.thumbRX;
+            pWork->thumbs[3][count] = sample.pad.thumbRY;
+            pWork->triggers[0][count] = sample.pad.leftTrigger;
+            pWork->triggers[1][count] = sample.pad.rightTrigger;
+            count += sample.connected ? 1 : 0;
+        }
+        if (count == 0) {
+            return;
+        }
+        pStats->sampleCount += count;
+
+        // XeBbNEgK[z
+        for (int stick = 0; stick < 2; stick++) {
+            ComputeHeatmapCells(pWork->thumbs[stick * 2], pWork->thumbs[stick * 2 + 1], count, pWork->cells);
+            AccumulateLanes(pWork->cells, count, pWork->heatmap[stick]);
+            AccumulateTriggerLanes(pWork->triggers[stick], count, pWork->trigger[stick]);
+        }
+
+        // GbW
+        pWork->edges[0] = pWork->buttons[0] & ~pWork->prevButtons;
+        for (size_t i = 1; i < count; i++) {
+            pWork->edges[i] = pWork->buttons[i] & ~pWork->buttons[i - 1];
+        }
+        CountBits(pWork->buttons, count, pStats->heldSamples);
+        CountBits(pWork->edges, count, pStats->pressCount);
+
+        // ԁEԁiω̂Tvj
+        uint16_t prev = pWork->prevButtons;
+        for (size_t i = 0; i < count; i++) {
+            uint16_t changed = pWork->buttons[i] ^ prev;
+            prev = pWork->buttons[i];
+            if (changed == 0) {
+                continue;
+            }
+
+            uint64_t time = pWork->times[i];
+            for (int bit = 0; bit < ANALYZER_BUTTON_COUNT; bit++) {
+                uint16_t mask = static_cast<uint16_t>(1 << bit);
+                if ((changed & mask) == 0) {
+                    continue;
+                }
+
+                if (pWork->buttons[i] & mask) {
+                    if (pWork->lastPressBit >= 0 && pWork->lastPressBit != bit) {
+                        pStats->reactionTime[DurationBin(time - pWork->lastPressTime)]++;
+                    }
+                    pWork->pressStart[bit] = time;
+                    pWork->lastPressTime = time;
+                    pWork->lastPressBit = bit;
+                } else {
+                    pStats->pressDuration[bit][DurationBin(time - pWork->pressStart[bit])]++;
+                }
+            }
+        }
+        pWork->prevButtons = prev;
+    }
+
+    // qXgOWvʂ֑
+    void FoldLanes(const AnalyzeWork& work, InputCorpusStats* pStats) {
+        for (int stick = 0; stick < 2; stick++) {
+            for (int lane = 0; lane < HISTOGRAM_LANES; lane++) {
+                for (int i = 0; i < HEATMAP_CELLS; i++) {
+                    pStats->stickHeatmap[stick][i] += work.heatmap[stick][lane][i];
+                }
+                for (int i = 0; i < ANALYZER_TRIGGER_BINS; i++) {
+                    pStats->triggerHistogram[stick][i] += work.trigger[stick][lane][i];
+                }
+            }
+        }
+    }
+}
+
+//==============================================================================
+// Wvʂ𑫂킹
+//==============================================================================
+void MergeCorpusStats(InputCorpusStats* pDest, const InputCorpusStats& src) {
+    pDest->fileCount += src.fileCount;
+    pDest->failedFileCount += src.failedFileCount;
+    pDest->byteCount += src.byteCount;
+    pDest->sampleCount += src.sampleCount;
+    pDest->durationUs += src.durationUs;
+
+    for (int bit = 0; bit < ANALYZER_BUTTON_COUNT; bit++) {
+        pDest->pressCount[bit] += src.pressCount[bit];
+        pDest->heldSamples[bit] += src.heldSamples[bit];
+        for (int i = 0; i < ANALYZER_DURATION_BINS; i++) {
+            pDest->pressDuration[bit][i] += src.pressDuration[bit][i];
+        }
+    }
+    for (int i = 0; i < ANALYZER_DURATION_BINS; i++) {
+        pDest->reactionTime[i] += src.reactionTime[i];
+    }
+    for (int stick = 0; stick < 2; stick++) {
+        for (int i = 0; i < HEATMAP_CELLS; i++) {
+            pDest->stickHeatmap[stick][i] += src.stickHeatmap[stick][i];
+        }
+        for (int i = 0; i < ANALYZER_TRIGGER_BINS; i++) {
+            pDest->triggerHistogram[stick][i] += src.triggerHistogram[stick][i];
+        }
+    }
+}
+
+//==============================================================================
+// 1t@C̏Wv
+//==============================================================================
+bool AnalyzeRecording(const char* pPath, InputCorpusStats* pStats) {
+    InputRecordReader reader;
+    if (!reader.Open(pPath)) {
+        pStats->failedFileCount++;
+        return false;
+    }
+
+    AnalyzeWork* pWork = new (std::nothrow) AnalyzeWork;
+    if (pWork == nullptr) {
+        pStats->failedFileCount++;
+        return false;
+    }
+    memset(pWork->heatmap, 0, sizeof(pWork->heatmap));
+    memset(pWork->trigger, 0, sizeof(pWork->trigger));
+    pWork->prevButtons = 0;
+    memset(pWork->pressStart, 0, sizeof(pWork->pressStart));
+    pWork->lastPressTime = 0;
+    pWork->lastPressBit = -1;
+
+    uint64_t beginTime = 0;
+    uint64_t endTime = 0;
+    bool hasSample = false;
+    size_t count;
+    while ((count = reader.NextBatch(pWork->samples, BATCH_SAMPLES)) != 0) {
+        if (!hasSample) {
+            beginTime = pWork->samples[0].timeUs;
+            hasSample = true;
+        }
+        endTime = pWork->samples[count - 1].timeUs;
+        AnalyzeBatch(pWork, count, pStats);
+    }
+    FoldLanes(*pWork, pStats);
+    delete pWork;
+
+    // rŉĂĂǂ߂Ƃ܂ł͐
+    if (reader.HasError()) {
+        pStats->failedFileCount++;
+    } else {
+        pStats->fileCount++;
+    }
+    pStats->byteCount += reader.GetFileSize();
+    pStats->durationUs += endTime - beginTime;
+    return !reader.HasError();
+}
+
+//==============================================================================
+// Wv
+//==============================================================================
+void AnalyzeCorpus(const char* const* pPaths, size_t pathCount, int threadCount, InputCorpusStats* pStats) {
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+        if (threadCount <= 0) threadCount = 1;
+    }
+    if (static_cast<size_t>(threadCount) > pathCount) {
+        threadCount = static_cast<int>(pathCount);
+    }
+    if (threadCount <= 1) {
+        for (size_t i = 0; i < pathCount; i++) {
+            AnalyzeRecording(pPaths[i], pStats);
+        }
+        return;
+    }
+
+    // t@C̑傫͂܂܂Ȃ̂ŁA󂢂Xbh̃t@Cɍs
+    std::atomic<size_t> nextIndex(0);
+    std::vector<InputCorpusStats> threadStats(threadCount);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+        InputCorpusStats* pThreadStats = &threadStats[t];
+        threads.emplace_back([=, &nextIndex]() {
+            size_t index;
+            while ((index = nextIndex.fetch_add(1)) < pathCount) {
+                AnalyzeRecording(pPaths[index], pThreadStats);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (const InputCorpusStats& stats : threadStats) {
+        MergeCorpusStats(pStats, stats);
+    }
+}
+
+//==============================================================================
+// fBNg̋L^t@C
+//==============================================================================
+int EnumerateRecordFiles(const char* pDirectory, RecordFileCallback pCallback, void* pContext) {
+    char path[1024];
+    int count = 0;
+
+#ifdef _WIN32
+    sprintf_s(path, sizeof(path), "%s\\*.xir", pDirectory);
+    WIN32_FIND_DATAA findData;
+    HANDLE hFind = FindFirstFileA(path, &findData);
+    if (hFind == INVALID_HANDLE_VALUE) {
+        return 0;
+    }
+    do {
+        if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+            continue;
+        }
+        sprintf_s(path, sizeof(path), "%s\\%s", pDirectory, findData.cFileName);
+        pCallback(path, pContext);
+        count++;
+    } while (FindNextFileA(hFind, &findData));
+    FindClose(hFind);
+#else
+    DIR* pDir = opendir(pDirectory);
+    if (pDir == nullptr) {
+        return 0;
+    }
+    struct dirent* pEntry;
+    while ((pEntry = readdir(pDir)) != nullptr) {
+        size_t length = strlen(pEntry->d_name);
+        if (length < 4 || strcmp(pEntry->d_name + length - 4, ".xir") != 0) {
+            continue;
+        }
+        snprintf(path, sizeof(path), "%s/%s", pDirectory, pEntry->d_name);
+        pCallback(path, pContext);
+        count++;
+    }
+    closedir(pDir);
+#endif
+
+    return count;
+}
+
+//==============================================================================
+// \
+//==============================================================================
+void PrintCorpusStats(const InputCorpusStats& stats, FILE* pOut) {
+    uint64_t seconds = stats.durationUs / 1000000;
+    fprintf(pOut, "files %llu (failed %llu)  samples %llu  duration %llu:%02llu:%02llu  size %.1f MB\n",
+        static_cast<unsigned long long>(stats.fileCount),
+        static_cast<unsigned long long>(stats.failedFileCount),
+        static_cast<unsigned long long>(stats.sampleCount),
+        static_cast<unsigned long long>(seconds / 3600),
+        static_cast<unsigned long long>(seconds / 60 % 60),
+        static_cast<unsigned long long>(seconds % 60),
+        stats.byteCount / (1024.0 * 1024.0));
+
+    // {^
+    fprintf(pOut, "\nbutton   presses    held%%  press p50  press p90\n");
+    for (int bit = 0; bit < ANALYZER_BUTTON_COUNT; bit++) {
+        if (stats.pressCount[bit] == 0 && stats.heldSamples[bit] == 0) {
+            continue;
+        }
+        char p50[32];
+        char p90[32];
+        FormatPercentile(p50, sizeof(p50), stats.pressDuration[bit], 0.5);
+        FormatPercentile(p90, sizeof(p90), stats.pressDuration[bit], 0.9);
+        double held = (stats.sampleCount != 0) ? 100.0 * stats.heldSamples[bit] / stats.sampleCount : 0.0;
+        fprintf(pOut, "%-6s %9llu  %6.2f%%  %9s  %9s\n", BUTTON_NAMES[bit],
+            static_cast<unsigned long long>(stats.pressCount[bit]), held, p50, p90);
+    }
+
+    char p50[32];
+    char p90[32];
+    FormatPercentile(p50, sizeof(p50), stats.reactionTime, 0.5);
+    FormatPercentile(p90, sizeof(p90), stats.reactionTime, 0.9);
+    fprintf(pOut, "\nreaction (press -> other press)  p50 %s  p90 %s\n", p50, p90);
+
+    // gK[irƂ̊ZWŁj
+    fprintf(pOut, "\ntrigger   0%%%*s100%%\n", ANALYZER_TRIGGER_BINS - 3, "");
+    for (int side = 0; side < 2; side++) {
+        uint64_t peak = 1;
+        for (int i = 1; i < ANALYZER_TRIGGER_BINS; i++) {
+            if (stats.triggerHistogram[side][i] > peak) peak = stats.triggerHistogram[side][i];
+        }
+        char line[ANALYZER_TRIGGER_BINS + 1];
+        for (int i = 0; i < ANALYZER_TRIGGER_BINS; i++) {
+            // Ă鎞ԂقƂǂȂ̂0̃r͏ĐK
+            uint64_t value = stats.triggerHistogram[side][i];
+            int level = static_cast<int>(value * SHADE_LEVELS / peak);
+            if (level > SHADE_LEVELS) level = SHADE_LEVELS;
+            if (value != 0 && level == 0) level = 1;
+            line[i] = SHADE_CHARS[level];
+        }
+        line[ANALYZER_TRIGGER_BINS] = '\0';
+        fprintf(pOut, "%s  [%s]\n", side == 0 ? "LT     " : "RT     ", line);
+    }
+
+    // XeBbNzi2x2}X܂Ƃ߂āAőlɑ΂銄̕ŔZWj
+    constexpr int SCALE = ANALYZER_HEATMAP_SIZE / HEATMAP_PRINT_SIZE;
+    uint64_t cells[2][HEATMAP_PRINT_SIZE][HEATMAP_PRINT_SIZE] = {};
+    uint64_t peak[2] = { 1, 1 };
+    for (int stick = 0; stick < 2; stick++) {
+        for (int y = 0; y < ANALYZER_HEATMAP_SIZE; y++) {
+            for (int x = 0; x < ANALYZER_HEATMAP_SIZE; x++) {
+                cells[stick][y / SCALE][x / SCALE] += stats.stickHeatmap[stick][y * ANALYZER_HEATMAP_SIZE + x];
+            }
+        }
+        for (int y = 0; y < HEATMAP_PRINT_SIZE; y++) {
+            for (int x = 0; x < HEATMAP_PRINT_SIZE; x++) {
+                if (cells[stick][y][x] > peak[stick]) peak[stick] = cells[stick][y][x];
+            }
+        }
+    }
+
+    fprintf(pOut, "\n%-*s    %s\n", HEATMAP_PRINT_SIZE + 2, "left stick", "right stick");
+    for (int y = 0; y < HEATMAP_PRINT_SIZE; y++) {
+        char line[2][HEATMAP_PRINT_SIZE + 1];
+        for (int stick = 0; stick < 2; stick++) {
+            for (int x = 0; x < HEATMAP_PRINT_SIZE; x++) {
+                double ratio = static_cast<double>(cells[stick][y][x]) / peak[stick];
+                int level = static_cast<int>(sqrt(ratio) * SHADE_LEVELS + 0.5);
+                if (cells[stick][y][x] != 0 && level == 0) level = 1;
+                line[stick][x] = SHADE_CHARS[level];
+            }
+            line[stick][HEATMAP_PRINT_SIZE] = '\0';
+        }
+        fprintf(pOut, "[%s]    [%s]\n", line[0], line[1]);
+    }
+}
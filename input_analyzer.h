@@ -0,0 +1,64 @@
+/*****************************************************************//**
+ * \file   input_analyzer.h
+ * \brief  L^t@CQ̃ItCWvi{^gpEXeBbNzȂǁj
+ *
+ * L^t@C̓}bvŊJAt@CPʂŃXbhɊUB
+ * eXbh͎p̏WvɉZAŌɂ܂Ƃ߂đ킹B
+ * 1t@C̒̓Tv܂Ƃ߂ăfR[hAƂ̔zɕבւĂ
+ * rԍꊇvZi[vxNg悤ȂjB
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+//==============================================================================
+// 萔
+//==============================================================================
+constexpr int ANALYZER_BUTTON_COUNT = 16;       // {^̃rbg
+constexpr int ANALYZER_HEATMAP_SIZE = 32;       // XeBbNz̈ӂ̃}X
+constexpr int ANALYZER_TRIGGER_BINS = 32;       // gK[z̃r
+constexpr int ANALYZER_DURATION_BINS = 20;      // ԕz̃ri1ms2{݁j
+
+//==============================================================================
+// Wv
+//==============================================================================
+struct InputCorpusStats {
+    uint64_t fileCount = 0;             // Wvłt@C
+    uint64_t failedFileCount = 0;       // JȂEĂt@C
+    uint64_t byteCount = 0;             // ǂ񂾃oCg
+    uint64_t sampleCount = 0;           // ڑ̃Tv
+    uint64_t durationUs = 0;            // L^̍v
+
+    // {^irbgԍƁj
+    uint64_t pressCount[ANALYZER_BUTTON_COUNT] = {};        // 
+    uint64_t heldSamples[ANALYZER_BUTTON_COUNT] = {};       // ĂTv
+    uint64_t pressDuration[ANALYZER_BUTTON_COUNT][ANALYZER_DURATION_BINS] = {};
+
+    // ԁi{^Ăʂ̃{^܂Łj
+    uint64_t reactionTime[ANALYZER_DURATION_BINS] = {};
+
+    // XeBbNz [E][Y][X]iY͏オ0j
+    uint64_t stickHeatmap[2][ANALYZER_HEATMAP_SIZE * ANALYZER_HEATMAP_SIZE] = {};
+
+    // gK[z [E][r]
+    uint64_t triggerHistogram[2][ANALYZER_TRIGGER_BINS] = {};
+};
+
+// Wvʂ𑫂킹
+void MergeCorpusStats(InputCorpusStats* pDest, const InputCorpusStats& src);
+
+// 1t@CWvpStatsɉZiJȂfailedFileCount𑝂₵falsej
+bool AnalyzeRecording(const char* pPath, InputCorpusStats* pStats);
+
+// t@CɏWvithreadCount0ȂCPŨRAj
+void AnalyzeCorpus(const char* const* pPaths, size_t pathCount, int threadCount, InputCorpusStats* pStats);
+
+// fBNg̋L^t@Ci*.xirj񋓂pCallbackɓn
+typedef void(*RecordFileCallback)(const char* pPath, void* pContext);
+int EnumerateRecordFiles(const char* pDirectory, RecordFileCallback pCallback, void* pContext);
+
+// Wvʂ\
+void PrintCorpusStats(const InputCorpusStats& stats, FILE* pOut);
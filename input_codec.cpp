@@ -0,0 +1,744 @@
+/*****************************************************************//**
+ * \file   input_codec.cpp
+ * \brief  ̓Tv̈kR[fbNiEϒEj
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "input_codec.h"
+#include <new>
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // R[h̃}XNiǂ̒lωj
+    constexpr uint8_t MASK_BUTTONS = 0x01;
+    constexpr uint8_t MASK_LEFT_TRIGGER = 0x02;
+    constexpr uint8_t MASK_RIGHT_TRIGGER = 0x04;
+    constexpr uint8_t MASK_THUMB_LX = 0x08;
+    constexpr uint8_t MASK_THUMB_LY = 0x10;
+    constexpr uint8_t MASK_THUMB_RX = 0x20;
+    constexpr uint8_t MASK_THUMB_RY = 0x40;
+
+    // ^O
+    constexpr uint8_t TAG_RUN_BASE = 0x7F;          // 0x80 ~ 0xFE: itag - 0x7F j
+    constexpr uint32_t MAX_SHORT_RUN = 0xFE - TAG_RUN_BASE;
+    constexpr uint8_t TAG_EXTENDED = 0xFF;
+
+    // gR[h̎
+    constexpr uint8_t EXT_LONG_RUN = 0x01;          // varintŌ
+    constexpr uint8_t EXT_CONNECTION = 0x02;        // 1oCgŐڑ
+    constexpr uint8_t EXT_END = 0x03;               // I[
+    constexpr uint8_t EXT_KEYFRAME = 0x04;          // Et[ԍivarintj{S13oCg
+
+    // L[t[̑Sԕ̃oCg
+    constexpr size_t KEYFRAME_STATE_BYTES = 13;
+
+    // t̒lցi0,-1,1,-2...  0,1,2,3...j
+    inline uint64_t ZigZag(int64_t value) {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    inline int64_t UnZigZag(uint64_t value) {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    inline uint8_t* WriteVarint(uint8_t* p, uint64_t value) {
+        while (value >= 0x80) {
+            *p++ = static_cast<uint8_t>(value | 0x80);
+            value >>= 7;
+        }
+        *p++ = static_cast<uint8_t>(value);
+        return p;
+    }
+
+    inline bool IsSamePad(const RawGamepad& a, const RawGamepad& b) {
+        return a.buttons == b.buttons &&
+            a.leftTrigger == b.leftTrigger && a.rightTrigger == b.rightTrigger &&
+            a.thumbLX == b.thumbLX && a.thumbLY == b.thumbLY &&
+            a.thumbRX == b.thumbRX && a.thumbRY == b.thumbRY;
+    }
+
+    inline void WriteU16(uint8_t* p, uint16_t value) {
+        p[0] = static_cast<uint8_t>(value);
+        p[1] = static_cast<uint8_t>(value >> 8);
+    }
+
+    inline void WriteU32(uint8_t* p, uint32_t value) {
+        WriteU16(p, static_cast<uint16_t>(value));
+        WriteU16(p + 2, static_cast<uint16_t>(value >> 16));
+    }
+
+    inline uint16_t ReadU16(const uint8_t* p) {
+        return static_cast<uint16_t>(p[0] | (p[1] << 8));
+    }
+
+    inline uint32_t ReadU32(const uint8_t* p) {
+        return ReadU16(p) | (static_cast<uint32_t>(ReadU16(p + 2)) << 16);
+    }
+
+    inline void WriteU64(uint8_t* p, uint64_t value) {
+        WriteU32(p, static_cast<uint32_t>(value));
+        WriteU32(p + 4, static_cast<uint32_t>(value >> 32));
+    }
+
+    inline uint64_t ReadU64(const uint8_t* p) {
+        return ReadU32(p) | (static_cast<uint64_t>(ReadU32(p + 4)) << 32);
+    }
+}
+
+//==============================================================================
+// GR[_[
+//==============================================================================
+void InputEncoder::Reset(uint32_t timeUnitUs, bool allowRuns) {
+    m_prev = {};
+    m_prevTime = 0;
+    m_timeDelta = 0;
+    m_pendingRun = 0;
+    m_timeUnit = (timeUnitUs != 0) ? timeUnitUs : 1;
+    m_allowRuns = allowRuns;
+}
+
+void InputEncoder::SetBase(const InputSample& base) {
+    m_prev = base;
+    m_prevTime = base.timeUs / m_timeUnit;
+    m_timeDelta = 0;
+    m_pendingRun = 0;
+}
+
+size_t InputEncoder::Encode(const InputSample& sample, uint8_t* pOut) {
+    uint64_t time = sample.timeUs / m_timeUnit;
+
+    // lԊuOƓȂ烉L΂
+    if (m_allowRuns &&
+        sample.connected == m_prev.connected &&
+        static_cast<int64_t>(time - m_prevTime) == m_timeDelta &&
+        IsSamePad(sample.pad, m_prev.pad)) {
+        m_pendingRun++;
+        m_prevTime = time;
+        return 0;
+    }
+
+    size_t size = Flush(pOut);
+    return size + WriteRecord(sample, time, pOut + size);
+}
+
+size_t InputEncoder::Flush(uint8_t* pOut) {
+    if (m_pendingRun == 0) {
+        return 0;
+    }
+
+    uint8_t* p = pOut;
+    if (m_pendingRun <= MAX_SHORT_RUN) {
+        *p++ = static_cast<uint8_t>(TAG_RUN_BASE + m_pendingRun);
+    } else {
+        *p++ = TAG_EXTENDED;
+        *p++ = EXT_LONG_RUN;
+        p = WriteVarint(p, m_pendingRun);
+    }
+    m_pendingRun = 0;
+    return static_cast<size_t>(p - pOut);
+}
+
+size_t InputEncoder::EncodeKeyframe(const InputSample& sample, uint64_t frame, uint8_t* pOut) {
+    uint64_t time = sample.timeUs / m_timeUnit;
+    const RawGamepad& pad = sample.pad;
+    uint8_t* p = pOut;
+
+    *p++ = TAG_EXTENDED;
+    *p++ = EXT_KEYFRAME;
+    p = WriteVarint(p, time);
+    p = WriteVarint(p, frame);
+    WriteU16(p, pad.buttons);
+    p[2] = pad.leftTrigger;
+    p[3] = pad.rightTrigger;
+    WriteU16(p + 4, static_cast<uint16_t>(pad.thumbLX));
+    WriteU16(p + 6, static_cast<uint16_t>(pad.thumbLY));
+    WriteU16(p + 8, static_cast<uint16_t>(pad.thumbRX));
+    WriteU16(p + 10, static_cast<uint16_t>(pad.thumbRY));
+    p[12] = sample.connected ? 1 : 0;
+    p += KEYFRAME_STATE_BYTES;
+
+    // L[t[ȍ~͂ɓǂ߂悤Ԃ؂
+    m_prev = sample;
+    m_prevTime = time;
+    m_timeDelta = 0;
+    m_pendingRun = 0;
+    return static_cast<size_t>(p - pOut);
+}
+
+size_t InputEncoder::Finish(uint8_t* pOut) {
+    size_t size = Flush(pOut);
+    pOut[size++] = TAG_EXTENDED;
+    pOut[size++] = EXT_END;
+    return size;
+}
+
+size_t InputEncoder::WriteRecord(const InputSample& sample, uint64_t time, uint8_t* pOut) {
+    const RawGamepad& a = m_prev.pad;
+    const RawGamepad& b = sample.pad;
+    uint8_t* p = pOut;
+
+    // ڑԂ̕ω͊gR[hŐɏ
+    if (sample.connected != m_prev.connected) {
+        *p++ = TAG_EXTENDED;
+        *p++ = EXT_CONNECTION;
+        *p++ = sample.connected ? 1 : 0;
+    }
+
+    uint8_t mask = 0;
+    if (a.buttons != b.buttons) mask |= MASK_BUTTONS;
+    if (a.leftTrigger != b.leftTrigger) mask |= MASK_LEFT_TRIGGER;
+    if (a.rightTrigger != b.rightTrigger) mask |= MASK_RIGHT_TRIGGER;
+    if (a.thumbLX != b.thumbLX) mask |= MASK_THUMB_LX;
+    if (a.thumbLY != b.thumbLY) mask |= MASK_THUMB_LY;
+    if (a.thumbRX != b.thumbRX) mask |= MASK_THUMB_RX;
+    if (a.thumbRY != b.thumbRY) mask |= MASK_THUMB_RY;
+    *p++ = mask;
+
+    // ́uO̊ԊuƂ̍viȂق0j
+    int64_t timeDelta = static_cast<int64_t>(time - m_prevTime);
+    p = WriteVarint(p, ZigZag(timeDelta - m_timeDelta));
+
+    // {^͕ωrbgA͑OƂ̍
+    if (mask & MASK_BUTTONS) p = WriteVarint(p, a.buttons ^ b.buttons);
+    if (mask & MASK_LEFT_TRIGGER) p = WriteVarint(p, ZigZag(b.leftTrigger - a.leftTrigger));
+    if (mask & MASK_RIGHT_TRIGGER) p = WriteVarint(p, ZigZag(b.rightTrigger - a.rightTrigger));
+    if (mask & MASK_THUMB_LX) p = WriteVarint(p, ZigZag(b.thumbLX - a.thumbLX));
+    if (mask & MASK_THUMB_LY) p = WriteVarint(p, ZigZag(b.thumbLY - a.thumbLY));
+    if (mask & MASK_THUMB_RX) p = WriteVarint(p, ZigZag(b.thumbRX - a.thumbRX));
+    if (mask & MASK_THUMB_RY) p = WriteVarint(p, ZigZag(b.thumbRY - a.thumbRY));
+
+    m_prev = sample;
+    m_prevTime = time;
+    m_timeDelta = timeDelta;
+    return static_cast<size_t>(p - pOut);
+}
+
+//==============================================================================
+// fR[_[
+//==============================================================================
+void InputDecoder::Reset(uint32_t timeUnitUs) {
+    m_pBegin = nullptr;
+    m_pCur = nullptr;
+    m_pEnd = nullptr;
+    m_prev = {};
+    m_prevTime = 0;
+    m_timeDelta = 0;
+    m_runRemaining = 0;
+    m_timeUnit = (timeUnitUs != 0) ? timeUnitUs : 1;
+    m_keyframeFrame = 0;
+    m_ended = false;
+    m_error = false;
+}
+
+void InputDecoder::SetBase(const InputSample& base) {
+    m_prev = base;
+    m_prevTime = base.timeUs / m_timeUnit;
+    m_timeDelta = 0;
+    m_runRemaining = 0;
+    m_ended = false;
+    m_error = false;
+}
+
+void InputDecoder::SetData(const uint8_t* pData, size_t size) {
+    m_pBegin = pData;
+    m_pCur = pData;
+    m_pEnd = pData + size;
+}
+
+bool InputDecoder::ReadVarint(uint64_t* pValue) {
+    uint64_t value = 0;
+    int shift = 0;
+    while (m_pCur < m_pEnd && shift < 64) {
+        uint8_t byte = *m_pCur++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            *pValue = value;
+            return true;
+        }
+        shift += 7;
+    }
+    m_error = true;
+    return false;
+}
+
+// 1R[hǂm_prevXViȂm_runRemainingݒj
+bool InputDecoder::ReadRecord() {
+    for (;;) {
+        if (m_ended || m_error || m_pCur >= m_pEnd) {
+            return false;
+        }
+
+        uint8_t tag = *m_pCur++;
+
+        // 
+        if (tag > TAG_RUN_BASE && tag != TAG_EXTENDED) {
+            m_runRemaining = tag - TAG_RUN_BASE;
+            return true;
+        }
+
+        // gR[h
+        if (tag == TAG_EXTENDED) {
+            if (m_pCur >= m_pEnd) {
+                m_error = true;
+                return false;
+            }
+            uint8_t type = *m_pCur++;
+            if (type == EXT_LONG_RUN) {
+                uint64_t count;
+                if (!ReadVarint(&count) || count == 0 || count > 0xFFFFFFFFULL) {
+                    m_error = true;
+                    return false;
+                }
+                m_runRemaining = static_cast<uint32_t>(count);
+                return true;
+            }
+            if (type == EXT_CONNECTION && m_pCur < m_pEnd) {
+                m_prev.connected = (*m_pCur++ != 0);
+                continue;
+            }
+            if (type == EXT_END) {
+                m_ended = true;
+                return false;
+            }
+            if (type == EXT_KEYFRAME) {
+                uint64_t time;
+                uint64_t frame;
+                if (!ReadVarint(&time) || !ReadVarint(&frame)) return false;
+                if (static_cast<size_t>(m_pEnd - m_pCur) < KEYFRAME_STATE_BYTES) {
+                    m_error = true;
+                    return false;
+                }
+                RawGamepad& pad = m_prev.pad;
+                pad.buttons = ReadU16(m_pCur);
+                pad.leftTrigger = m_pCur[2];
+                pad.rightTrigger = m_pCur[3];
+                pad.thumbLX = static_cast<int16_t>(ReadU16(m_pCur + 4));
+                pad.thumbLY = static_cast<int16_t>(ReadU16(m_pCur + 6));
+                pad.thumbRX = static_cast<int16_t>(ReadU16(m_pCur + 8));
+                pad.thumbRY = static_cast<int16_t>(ReadU16(m_pCur + 10));
+                m_prev.connected = (m_pCur[12] != 0);
+                m_pCur += KEYFRAME_STATE_BYTES;
+
+                m_prevTime = time;
+                m_prev.timeUs = time * m_timeUnit;
+                m_timeDelta = 0;
+                m_keyframeFrame = frame;
+                return true;
+            }
+            m_error = true;
+            return false;
+        }
+
+        // R[h
+        uint64_t value;
+        if (!ReadVarint(&value)) return false;
+        m_timeDelta += UnZigZag(value);
+        m_prevTime += m_timeDelta;
+
+        RawGamepad& pad = m_prev.pad;
+        if (tag & MASK_BUTTONS) {
+            if (!ReadVarint(&value)) return false;
+            pad.buttons ^= static_cast<uint16_t>(value);
+        }
+        if (tag & MASK_LEFT_TRIGGER) {
+            if (!ReadVarint(&value)) return false;
+            pad.leftTrigger = static_cast<uint8_t>(pad.leftTrigger + UnZigZag(value));
+        }
+        if (tag & MASK_RIGHT_TRIGGER) {
+            if (!ReadVarint(&value)) return false;
+            pad.rightTrigger = static_cast<uint8_t>(pad.rightTrigger + UnZigZag(value));
+        }
+        if (tag & MASK_THUMB_LX) {
+            if (!ReadVarint(&value)) return false;
+            pad.thumbLX = static_cast<int16_t>(pad.thumbLX + UnZigZag(value));
+        }
+        if (tag & MASK_THUMB_LY) {
+            if (!ReadVarint(&value)) return false;
+            pad.thumbLY = static_cast<int16_t>(pad.thumbLY + UnZigZag(value));
+        }
+        if (tag & MASK_THUMB_RX) {
+            if (!ReadVarint(&value)) return false;
+            pad.thumbRX = static_cast<int16_t>(pad.thumbRX + UnZigZag(value));
+        }
+        if (tag & MASK_THUMB_RY) {
+            if (!ReadVarint(&value)) return false;
+            pad.thumbRY = static_cast<int16_t>(pad.thumbRY + UnZigZag(value));
+        }
+        m_prev.timeUs = m_prevTime * m_timeUnit;
+        return true;
+    }
+}
+
+bool InputDecoder::Next(InputSample* pSample) {
+    if (m_runRemaining == 0) {
+        if (!ReadRecord()) {
+            return false;
+        }
+        if (m_runRemaining == 0) {
+            *pSample = m_prev;
+            return true;
+        }
+    }
+
+    // Fl͂̂܂܁AԊuŐi߂
+    m_runRemaining--;
+    m_prevTime += m_timeDelta;
+    m_prev.timeUs = m_prevTime * m_timeUnit;
+    *pSample = m_prev;
+    return true;
+}
+
+size_t InputDecoder::NextBatch(InputSample* pSamples, size_t maxCount) {
+    size_t count = 0;
+    while (count < maxCount) {
+        // ͂܂Ƃ߂ēWJ
+        while (m_runRemaining > 0 && count < maxCount) {
+            m_runRemaining--;
+            m_prevTime += m_timeDelta;
+            m_prev.timeUs = m_prevTime * m_timeUnit;
+            pSamples[count++] = m_prev;
+        }
+        if (count == maxCount || !ReadRecord()) {
+            break;
+        }
+        if (m_runRemaining == 0) {
+            pSamples[count++] = m_prev;
+        }
+    }
+    return count;
+}
+
+//==============================================================================
+// wb_[̓ǂݏ
+//==============================================================================
+void WriteInputRecordHeader(uint8_t* pOut, uint32_t timeUnitUs) {
+    WriteU32(pOut, INPUT_RECORD_MAGIC);
+    WriteU16(pOut + 4, INPUT_RECORD_VERSION);
+    WriteU16(pOut + 6, static_cast<uint16_t>(INPUT_RECORD_HEADER_BYTES));
+    WriteU32(pOut + 8, timeUnitUs);
+    WriteU32(pOut + 12, 0);
+}
+
+bool ReadInputRecordHeader(const uint8_t* pData, size_t size, uint32_t* pTimeUnitUs, uint16_t* pVersion) {
+    if (size < INPUT_RECORD_HEADER_BYTES) return false;
+    if (ReadU32(pData) != INPUT_RECORD_MAGIC) return false;
+    if (ReadU16(pData + 4) == 0 || ReadU16(pData + 4) > INPUT_RECORD_VERSION) return false;
+    if (ReadU16(pData + 6) != INPUT_RECORD_HEADER_BYTES) return false;
+
+    *pVersion = ReadU16(pData + 4);
+    *pTimeUnitUs = ReadU32(pData + 8);
+    return *pTimeUnitUs != 0;
+}
+
+//==============================================================================
+// L^t@C
+//==============================================================================
+bool InputRecordWriter::Open(const char* pPath, uint32_t timeUnitUs, uint32_t keyframeInterval) {
+    Close();
+    if (fopen_s(&m_pFile, pPath, "wb") != 0 || m_pFile == nullptr) {
+        m_pFile = nullptr;
+        return false;
+    }
+
+    if (timeUnitUs == 0) timeUnitUs = 1;
+    m_encoder.Reset(timeUnitUs, true);
+    m_timeUnit = timeUnitUs;
+    m_sampleCount = 0;
+    m_byteCount = 0;
+    m_lastTimeUs = 0;
+    m_keyframeInterval = (keyframeInterval != 0) ? keyframeInterval : 1;
+    m_index.clear();
+
+    WriteInputRecordHeader(m_buffer, timeUnitUs);
+    m_bufferUsed = INPUT_RECORD_HEADER_BYTES;
+    return true;
+}
+
+bool InputRecordWriter::Write(const InputSample& sample) {
+    if (m_pFile == nullptr) {
+        return false;
+    }
+    if (m_bufferUsed + INPUT_CODEC_MAX_RECORD_BYTES * 2 > BUFFER_BYTES && !FlushBuffer()) {
+        return false;
+    }
+
+    if (m_sampleCount % m_keyframeInterval == 0) {
+        // ؂ĂL[t[̈ʒuɐς
+        m_bufferUsed += m_encoder.Flush(m_buffer + m_bufferUsed);
+
+        InputIndexEntry entry;
+        entry.timeUs = sample.timeUs / m_timeUnit * m_timeUnit;
+        entry.frame = m_sampleCount;
+        entry.offset = GetByteCount();
+        m_index.push_back(entry);
+
+        m_bufferUsed += m_encoder.EncodeKeyframe(sample, m_sampleCount, m_buffer + m_bufferUsed);
+    } else {
+        m_bufferUsed += m_encoder.Encode(sample, m_buffer + m_bufferUsed);
+    }
+
+    m_lastTimeUs = sample.timeUs / m_timeUnit * m_timeUnit;
+    m_sampleCount++;
+    return true;
+}
+
+bool InputRecordWriter::Close() {
+    if (m_pFile == nullptr) {
+        return false;
+    }
+
+    bool ok = true;
+    if (m_bufferUsed + INPUT_CODEC_MAX_RECORD_BYTES > BUFFER_BYTES) {
+        ok = FlushBuffer();
+    }
+    m_bufferUsed += m_encoder.Finish(m_buffer + m_bufferUsed);
+    ok = FlushBuffer() && ok;
+    ok = WriteIndex() && ok;
+
+    ok = (fclose(m_pFile) == 0) && ok;
+    m_pFile = nullptr;
+    return ok;
+}
+
+bool InputRecordWriter::FlushBuffer() {
+    size_t written = fwrite(m_buffer, 1, m_bufferUsed, m_pFile);
+    bool ok = (written == m_bufferUsed);
+    m_byteCount += written;
+    m_bufferUsed = 0;
+    return ok;
+}
+
+// ƃg[[
+// g[[: indexOffset(8) sampleCount(8) endTimeUs(8) entryCount(4) magic(4)
+bool InputRecordWriter::WriteIndex() {
+    uint64_t indexOffset = m_byteCount;
+
+    for (const InputIndexEntry& entry : m_index) {
+        if (m_bufferUsed + INPUT_INDEX_ENTRY_BYTES > BUFFER_BYTES && !FlushBuffer()) {
+            return false;
+        }
+        uint8_t* p = m_buffer + m_bufferUsed;
+        WriteU64(p, entry.timeUs);
+        WriteU64(p + 8, entry.frame);
+        WriteU64(p + 16, entry.offset);
+        m_bufferUsed += INPUT_INDEX_ENTRY_BYTES;
+    }
+
+    if (m_bufferUsed + INPUT_INDEX_TRAILER_BYTES > BUFFER_BYTES && !FlushBuffer()) {
+        return false;
+    }
+    uint8_t* p = m_buffer + m_bufferUsed;
+    WriteU64(p, indexOffset);
+    WriteU64(p + 8, m_sampleCount);
+    WriteU64(p + 16, m_lastTimeUs);
+    WriteU32(p + 24, static_cast<uint32_t>(m_index.size()));
+    WriteU32(p + 28, INPUT_INDEX_MAGIC);
+    m_bufferUsed += INPUT_INDEX_TRAILER_BYTES;
+
+    return FlushBuffer();
+}
+
+//==============================================================================
+// L^t@Cǂݍ
+//==============================================================================
+bool InputRecordReader::Open(const char* pPath) {
+    Close();
+    if (!m_file.Open(pPath)) {
+        return false;
+    }
+
+    m_pData = m_file.GetData();
+    m_size = m_file.GetSize();
+    if (!Parse()) {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+bool InputRecordReader::OpenMemory(const uint8_t* pData, size_t size) {
+    Close();
+    m_pData = pData;
+    m_size = size;
+    if (!Parse()) {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void InputRecordReader::Close() {
+    m_file.Close();
+    m_pData = nullptr;
+    m_size = 0;
+    m_recordEnd = 0;
+    m_decoder.Reset();
+    m_hasPeek = false;
+    m_frame = 0;
+    m_index.clear();
+    m_sampleCount = 0;
+    m_endTimeUs = 0;
+}
+
+bool InputRecordReader::Parse() {
+    uint16_t version = 0;
+    if (!ReadInputRecordHeader(m_pData, m_size, &m_timeUnit, &version)) {
+        return false;
+    }
+
+    // Ȃi`EݓrŏIjL^擪珇ɂ͓ǂ߂
+    m_recordEnd = m_size;
+    if (version >= 2) {
+        ReadIndex();
+    }
+
+    Rewind();
+    return true;
+}
+
+bool InputRecordReader::ReadIndex() {
+    if (m_size < INPUT_RECORD_HEADER_BYTES + INPUT_INDEX_TRAILER_BYTES) {
+        return false;
+    }
+
+    const uint8_t* pTrailer = m_pData + m_size - INPUT_INDEX_TRAILER_BYTES;
+    if (ReadU32(pTrailer + 28) != INPUT_INDEX_MAGIC) {
+        return false;
+    }
+
+    // ͊O痈lȂ̂ŁAZŌӂꂵȂ悤͈͂ƊZŊm߂Ămۂ
+    uint64_t indexOffset = ReadU64(pTrailer);
+    uint64_t entryCount = ReadU32(pTrailer + 24);
+    uint64_t indexEnd = m_size - INPUT_INDEX_TRAILER_BYTES;
+    if (indexOffset < INPUT_RECORD_HEADER_BYTES || indexOffset > indexEnd) {
+        return false;
+    }
+    uint64_t indexBytes = indexEnd - indexOffset;
+    if (indexBytes % INPUT_INDEX_ENTRY_BYTES != 0 || entryCount != indexBytes / INPUT_INDEX_ENTRY_BYTES) {
+        return false;
+    }
+
+    m_index.resize(static_cast<size_t>(entryCount));
+    const uint8_t* p = m_pData + indexOffset;
+    for (InputIndexEntry& entry : m_index) {
+        entry.timeUs = ReadU64(p);
+        entry.frame = ReadU64(p + 8);
+        entry.offset = ReadU64(p + 16);
+        p += INPUT_INDEX_ENTRY_BYTES;
+        if (entry.offset < INPUT_RECORD_HEADER_BYTES || entry.offset >= indexOffset) {
+            m_index.clear();
+            return false;
+        }
+    }
+
+    m_recordEnd = static_cast<size_t>(indexOffset);
+    m_sampleCount = ReadU64(pTrailer + 8);
+    m_endTimeUs = ReadU64(pTrailer + 16);
+    return true;
+}
+
+void InputRecordReader::Rewind() {
+    m_decoder.Reset(m_timeUnit);
+    m_decoder.SetData(m_pData + INPUT_RECORD_HEADER_BYTES, m_recordEnd - INPUT_RECORD_HEADER_BYTES);
+    m_hasPeek = false;
+    m_frame = 0;
+}
+
+void InputRecordReader::StartAt(const InputIndexEntry& entry) {
+    m_decoder.Reset(m_timeUnit);
+    m_decoder.SetData(m_pData + entry.offset, m_recordEnd - static_cast<size_t>(entry.offset));
+    m_hasPeek = false;
+    m_frame = entry.frame;
+}
+
+bool InputRecordReader::Next(InputSample* pSample) {
+    if (m_hasPeek) {
+        *pSample = m_peek;
+        m_hasPeek = false;
+        m_frame++;
+        return true;
+    }
+    if (!m_decoder.Next(pSample)) {
+        return false;
+    }
+    m_frame++;
+    return true;
+}
+
+size_t InputRecordReader::NextBatch(InputSample* pSamples, size_t maxCount) {
+    size_t count = 0;
+    if (m_hasPeek && maxCount > 0) {
+        pSamples[count++] = m_peek;
+        m_hasPeek = false;
+    }
+    count += m_decoder.NextBatch(pSamples + count, maxCount - count);
+    m_frame += count;
+    return count;
+}
+
+//==============================================================================
+// V[N
+//==============================================================================
+bool InputRecordReader::SeekToKeyframe(size_t indexEntry) {
+    if (indexEntry >= m_index.size()) {
+        return false;
+    }
+    StartAt(m_index[indexEntry]);
+    return true;
+}
+
+bool InputRecordReader::SeekToFrame(uint64_t frame) {
+    // frameȑOōŌ̃L[t[񕪒T
+    size_t lo = 0;
+    size_t hi = m_index.size();
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (m_index[mid].frame <= frame) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo > 0) {
+        StartAt(m_index[lo - 1]);
+    } else {
+        Rewind();
+    }
+
+    // L[t[ړĨt[̎O܂œǂݔ΂
+    InputSample sample;
+    while (m_frame < frame) {
+        if (!m_decoder.Next(&sample)) {
+            return false;
+        }
+        m_frame++;
+    }
+    return true;
+}
+
+bool InputRecordReader::SeekToTime(uint64_t timeUs) {
+    // timeUsȑOōŌ̃L[t[񕪒T
+    size_t lo = 0;
+    size_t hi = m_index.size();
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (m_index[mid].timeUs <= timeUs) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo > 0) {
+        StartAt(m_index[lo - 1]);
+    } else {
+        Rewind();
+    }
+
+    // ړI̎ȍ~̍ŏ̃Tvǂ݂Ă
+    InputSample sample;
+    while (m_decoder.Next(&sample)) {
+        if (sample.timeUs >= timeUs) {
+            m_peek = sample;
+            m_hasPeek = true;
+            return true;
+        }
+        m_frame++;
+    }
+    return false;
+}
@@ -0,0 +1,252 @@
+/*****************************************************************//**
+ * \file   input_codec.h
+ * \brief  ̓Tv̈kR[fbNiEϒEj
+ *
+ * R[h͐擪1oCg̃^OŎނ܂B
+ *   0x00 ~ 0x7F : R[hB7rbg͕ωl̃}XN
+ *                 ĎiOԊuƂ̍jAωl̍
+ *   0x80 ~ 0xFE : BOƓlEԊũTv (tag - 0x7F) 
+ *   0xFF        : gR[hB1oCgŎ
+ *                 iAڑԁAI[AL[t[j
+ * ׂ͂zigzag{7rbgϒA{^͕ωrbgXORB
+ *
+ * L^t@C͈TvƂɃL[t[iSԁj݁A
+ * ɁuEt[ԍ  L[t[̈ʒuv̍uB
+ *   [wb_[16B][R[h...][I[][ 24B~n][g[[32B]
+ * 񕪒TčŊ̃L[t[ǂݎn߂΁A
+ * L^ł擪ǂݒɔCӂ̈ʒuֈړłB
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "gamepad_state.h"
+#include "mapped_file.h"
+
+//==============================================================================
+// ̓TviEL^1j
+//==============================================================================
+struct InputSample {
+    uint64_t timeUs = 0;        // 擾i}CNbj
+    RawGamepad pad;             // ̓͒l
+    bool connected = false;     // ڑ
+};
+
+//==============================================================================
+// 萔
+//==============================================================================
+// 1Encode()/Flush()ŏoőoCg
+constexpr size_t INPUT_CODEC_MAX_RECORD_BYTES = 48;
+
+// L^t@C̃wb_[
+constexpr uint32_t INPUT_RECORD_MAGIC = 0x43524958;    // "XIRC"
+constexpr uint16_t INPUT_RECORD_VERSION = 2;           // 1: ȂA2: 
+constexpr size_t INPUT_RECORD_HEADER_BYTES = 16;
+
+// 
+constexpr uint32_t INPUT_INDEX_MAGIC = 0x58444958;     // "XIDX"
+constexpr size_t INPUT_INDEX_ENTRY_BYTES = 24;
+constexpr size_t INPUT_INDEX_TRAILER_BYTES = 32;
+
+// L[t[ފԊůliTvj
+constexpr uint32_t INPUT_RECORD_DEFAULT_KEYFRAME_INTERVAL = 1024;
+
+// L^t@C̎Pʂ̊li100usPʂɊۂ߂1kHz̗hꂪăɂȂj
+constexpr uint32_t INPUT_RECORD_DEFAULT_TIME_UNIT_US = 100;
+
+//==============================================================================
+// GR[_[
+//==============================================================================
+class InputEncoder {
+public:
+    // timeUnitUs: ̒PʁAallowRuns: falseȂ1Tv1R[hŏ
+    void Reset(uint32_t timeUnitUs = 1, bool allowRuns = true);
+
+    // OTvݒiL[t[̒ォ瑱Ƃj
+    void SetBase(const InputSample& base);
+
+    // TvǉApOutɏoCgԂ
+    // i̓r0ApOutɂ INPUT_CODEC_MAX_RECORD_BYTES ȏ̋󂫂Kvj
+    size_t Encode(const InputSample& sample, uint8_t* pOut);
+
+    // ۗ̃o
+    size_t Flush(uint8_t* pOut);
+
+    // L[t[iSԁ{t[ԍjƂăTv
+    // ۗ̃͐Flush()Ă
+    size_t EncodeKeyframe(const InputSample& sample, uint64_t frame, uint8_t* pOut);
+
+    // I[R[hiFlush݁j
+    size_t Finish(uint8_t* pOut);
+
+private:
+    size_t WriteRecord(const InputSample& sample, uint64_t time, uint8_t* pOut);
+
+    InputSample m_prev;
+    uint64_t m_prevTime = 0;        // PʊZ̎
+    int64_t m_timeDelta = 0;        // O̎ԊuiPʊZj
+    uint32_t m_pendingRun = 0;
+    uint32_t m_timeUnit = 1;
+    bool m_allowRuns = true;
+};
+
+//==============================================================================
+// fR[_[
+//==============================================================================
+class InputDecoder {
+public:
+    void Reset(uint32_t timeUnitUs = 1);
+
+    // OTvݒiL[t[瑱ēǂނƂj
+    void SetBase(const InputSample& base);
+
+    // ǂݍރf[^iԂ͈ێ܂ܓǂݏoʒuςj
+    void SetData(const uint8_t* pData, size_t size);
+
+    // ̃TvoiI[Ef[^Ejfalsej
+    bool Next(InputSample* pSample);
+
+    // ܂Ƃ߂ĎoioԂj
+    size_t NextBatch(InputSample* pSamples, size_t maxCount);
+
+    size_t GetPosition() const { return static_cast<size_t>(m_pCur - m_pBegin); }
+    // Oɓǂ񂾃L[t[̃t[ԍ
+    uint64_t GetKeyframeFrame() const { return m_keyframeFrame; }
+    bool IsEnded() const { return m_ended; }
+    bool HasError() const { return m_error; }
+
+private:
+    bool ReadVarint(uint64_t* pValue);
+    bool ReadRecord();
+
+    const uint8_t* m_pBegin = nullptr;
+    const uint8_t* m_pCur = nullptr;
+    const uint8_t* m_pEnd = nullptr;
+
+    InputSample m_prev;
+    uint64_t m_prevTime = 0;
+    int64_t m_timeDelta = 0;
+    uint32_t m_runRemaining = 0;
+    uint32_t m_timeUnit = 1;
+    uint64_t m_keyframeFrame = 0;
+    bool m_ended = false;
+    bool m_error = false;
+};
+
+//==============================================================================
+// 1ځiL[t[̈ʒuj
+//==============================================================================
+struct InputIndexEntry {
+    uint64_t timeUs = 0;        // L[t[̎
+    uint64_t frame = 0;         // L[t[̃Tvԍi擪0j
+    uint64_t offset = 0;        // t@C擪̃oCgʒu
+};
+
+//==============================================================================
+// L^t@C
+//==============================================================================
+class InputRecordWriter {
+public:
+    InputRecordWriter() = default;
+    ~InputRecordWriter() { Close(); }
+    InputRecordWriter(const InputRecordWriter&) = delete;
+    InputRecordWriter& operator=(const InputRecordWriter&) = delete;
+
+    bool Open(const char* pPath, uint32_t timeUnitUs = INPUT_RECORD_DEFAULT_TIME_UNIT_US,
+        uint32_t keyframeInterval = INPUT_RECORD_DEFAULT_KEYFRAME_INTERVAL);
+    bool Write(const InputSample& sample);
+    bool Close();
+
+    bool IsOpen() const { return m_pFile != nullptr; }
+    uint64_t GetSampleCount() const { return m_sampleCount; }
+    uint64_t GetByteCount() const { return m_byteCount + m_bufferUsed; }
+
+private:
+    bool FlushBuffer();
+    bool WriteIndex();
+
+    static constexpr size_t BUFFER_BYTES = 64 * 1024;
+
+    FILE* m_pFile = nullptr;
+    InputEncoder m_encoder;
+    uint8_t m_buffer[BUFFER_BYTES];
+    size_t m_bufferUsed = 0;
+    uint64_t m_sampleCount = 0;
+    uint64_t m_byteCount = 0;
+    uint32_t m_timeUnit = 1;
+    uint64_t m_lastTimeUs = 0;
+
+    // 
+    uint32_t m_keyframeInterval = INPUT_RECORD_DEFAULT_KEYFRAME_INTERVAL;
+    std::vector<InputIndexEntry> m_index;
+};
+
+//==============================================================================
+// L^t@Cǂݍ݁i}bvŊJAŃV[Nj
+//==============================================================================
+class InputRecordReader {
+public:
+    InputRecordReader() = default;
+    ~InputRecordReader() { Close(); }
+    InputRecordReader(const InputRecordReader&) = delete;
+    InputRecordReader& operator=(const InputRecordReader&) = delete;
+
+    bool Open(const char* pPath);
+    // ̃f[^Jif[^͕܂ŕێĂƁj
+    bool OpenMemory(const uint8_t* pData, size_t size);
+    void Close();
+
+    // 擪ǂݒ
+    void Rewind();
+    bool Next(InputSample* pSample);
+    size_t NextBatch(InputSample* pSamples, size_t maxCount);
+
+    // Next()ŕԂTvwʒuɍ킹
+    // Γ񕪒TōŊ̃L[t[AȂΐ擪ǂ
+    bool SeekToFrame(uint64_t frame);
+    bool SeekToTime(uint64_t timeUs);       // w莞ȍ~ōŏ̃Tv
+    bool SeekToKeyframe(size_t indexEntry); // nԖڂ̃L[t[
+
+    // Next()ŕԂTv̔ԍ
+    uint64_t GetFrame() const { return m_frame; }
+
+    // iȂL^ł0j
+    bool HasIndex() const { return !m_index.empty(); }
+    size_t GetIndexCount() const { return m_index.size(); }
+    const InputIndexEntry& GetIndexEntry(size_t i) const { return m_index[i]; }
+    uint64_t GetSampleCount() const { return m_sampleCount; }
+    uint64_t GetEndTime() const { return m_endTimeUs; }
+
+    bool HasError() const { return m_decoder.HasError(); }
+    uint32_t GetTimeUnit() const { return m_timeUnit; }
+    size_t GetFileSize() const { return m_size; }
+
+private:
+    bool Parse();
+    bool ReadIndex();
+    void StartAt(const InputIndexEntry& entry);
+
+    MappedFile m_file;
+    const uint8_t* m_pData = nullptr;
+    size_t m_size = 0;
+    size_t m_recordEnd = 0;             // R[h̏Ii̐擪j
+    uint32_t m_timeUnit = 1;
+    InputDecoder m_decoder;
+
+    // V[N1ǂ݂Tv
+    InputSample m_peek;
+    bool m_hasPeek = false;
+    uint64_t m_frame = 0;
+
+    std::vector<InputIndexEntry> m_index;
+    uint64_t m_sampleCount = 0;
+    uint64_t m_endTimeUs = 0;
+};
+
+// wb_[̓ǂݏi16oCg: magic, version, headerSize, timeUnitUs, reservedj
+// pVersionɂ͓ǂݍ񂾃o[WԂ
+void WriteInputRecordHeader(uint8_t* pOut, uint32_t timeUnitUs);
+bool ReadInputRecordHeader(const uint8_t* pData, size_t size, uint32_t* pTimeUnitUs, uint16_t* pVersion);
@@ -0,0 +1,199 @@
+/*****************************************************************//**
+ * \file   input_history.cpp
+ * \brief  ͗ikEt̃Oobt@j
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "input_history.h"
+#include <new>
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // Oeʂ̉i1ubN̍őTCY\傫j
+    constexpr size_t MIN_CAPACITY = 64 * 1024;
+
+    size_t RoundUpPowerOfTwo(size_t value) {
+        size_t result = 1;
+        while (result < value) result <<= 1;
+        return result;
+    }
+}
+
+//==============================================================================
+// 
+//==============================================================================
+bool InputHistory::Initialize(size_t memoryBytes) {
+    Finalize();
+
+    m_capacity = RoundUpPowerOfTwo(memoryBytes < MIN_CAPACITY ? MIN_CAPACITY : memoryBytes);
+    // Ȃ̃Tvł2oCgĝŁAubN͂ő
+    m_maxBlocks = static_cast<int>(m_capacity / BLOCK_SAMPLES) + 2;
+
+    m_pRing = new (std::nothrow) uint8_t[m_capacity];
+    m_pBlocks = new (std::nothrow) Block[m_maxBlocks];
+    if (m_pRing == nullptr || m_pBlocks == nullptr) {
+        Finalize();
+        return false;
+    }
+
+    Clear();
+    return true;
+}
+
+//==============================================================================
+// I
+//==============================================================================
+void InputHistory::Finalize() {
+    delete[] m_pRing;
+    delete[] m_pBlocks;
+    m_pRing = nullptr;
+    m_pBlocks = nullptr;
+    m_capacity = 0;
+    m_maxBlocks = 0;
+    Clear();
+}
+
+//==============================================================================
+// S
+//==============================================================================
+void InputHistory::Clear() {
+    m_readPos = 0;
+    m_writePos = 0;
+    m_firstBlock = 0;
+    m_blockCount = 0;
+    m_count = 0;
+    m_encoder.Reset(1, false);
+    m_cursorDecoder.Reset(1);
+    m_cursorIndex = -1;
+}
+
+//==============================================================================
+// Tvǉ
+//==============================================================================
+void InputHistory::Push(const InputSample& sample) {
+    if (m_pRing == nullptr) {
+        return;
+    }
+
+    bool newBlock = (m_blockCount == 0) || (BlockAt(m_blockCount - 1).sampleCount == BLOCK_SAMPLES);
+
+    if (newBlock) {
+        if (m_blockCount == m_maxBlocks && !EvictOldestBlock()) {
+            return;
+        }
+        Block& block = BlockAt(m_blockCount++);
+        block.keyframe = sample;
+        block.byteBegin = m_writePos;
+        block.sampleCount = 1;
+        m_encoder.SetBase(sample);
+    } else {
+        while (m_capacity - GetUsedBytes() < INPUT_CODEC_MAX_RECORD_BYTES) {
+            if (!EvictOldestBlock()) return;
+        }
+        uint8_t record[INPUT_CODEC_MAX_RECORD_BYTES];
+        size_t size = m_encoder.Encode(sample, record);
+        for (size_t i = 0; i < size; i++) {
+            m_pRing[(m_writePos + i) & (m_capacity - 1)] = record[i];
+        }
+        m_writePos += size;
+        BlockAt(m_blockCount - 1).sampleCount++;
+    }
+
+    m_count++;
+}
+
+//==============================================================================
+// Tv擾
+//==============================================================================
+bool InputHistory::GetSample(int index, InputSample* pSample) {
+    if (index < 0 || index >= m_count || pSample == nullptr) {
+        return false;
+    }
+
+    // ÂubN͏ɖtȂ̂Ŕԍ璼ڃubN܂
+    int blockIndex = index / BLOCK_SAMPLES;
+    int offset = index % BLOCK_SAMPLES;
+    const Block& block = BlockAt(blockIndex);
+
+    // ubNőOȂALbVʒu瑱ăfR[h
+    int cursorOffset = m_cursorIndex - blockIndex * BLOCK_SAMPLES;
+    if (m_cursorIndex < 0 || m_cursorIndex > index || cursorOffset < 0) {
+        m_cursorPos = block.byteBegin;
+        m_cursorSample = block.keyframe;
+        m_cursorDecoder.SetBase(block.keyframe);
+        cursorOffset = 0;
+    }
+
+    // O̐܂Ԃ܂Ƃ̂1R[hoăfR[h
+    for (int i = cursorOffset; i < offset; i++) {
+        uint8_t record[INPUT_CODEC_MAX_RECORD_BYTES];
+        size_t size = m_writePos - m_cursorPos;
+        if (size > sizeof(record)) size = sizeof(record);
+        for (size_t j = 0; j < size; j++) {
+            record[j] = m_pRing[(m_cursorPos + j) & (m_capacity - 1)];
+        }
+        m_cursorDecoder.SetData(record, size);
+        if (!m_cursorDecoder.Next(&m_cursorSample)) {
+            m_cursorIndex = -1;
+            return false;
+        }
+        m_cursorPos += m_cursorDecoder.GetPosition();
+    }
+
+    m_cursorIndex = index;
+    *pSample = m_cursorSample;
+    return true;
+}
+
+//==============================================================================
+// TvԍT
+//==============================================================================
+int InputHistory::FindIndexByTime(uint64_t timeUs) {
+    if (m_count == 0) {
+        return 0;
+    }
+
+    // L[t[̎œ񕪒T
+    int lo = 0;
+    int hi = m_blockCount;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (BlockAt(mid).keyframe.timeUs <= timeUs) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo == 0) {
+        return 0;
+    }
+
+    // ubN͏ɃfR[hĒT
+    int index = (lo - 1) * BLOCK_SAMPLES;
+    int end = index + BlockAt(lo - 1).sampleCount;
+    InputSample sample;
+    while (index + 1 < end && GetSample(index + 1, &sample) && sample.timeUs <= timeUs) {
+        index++;
+    }
+    return index;
+}
+
+//==============================================================================
+// ŌẪubN̂Ă
+//==============================================================================
+bool InputHistory::EvictOldestBlock() {
+    // ݒ̃ubN͎̂ĂȂ
+    if (m_blockCount <= 1) {
+        return false;
+    }
+
+    m_count -= BlockAt(0).sampleCount;
+    m_firstBlock = (m_firstBlock + 1) % m_maxBlocks;
+    m_blockCount--;
+    m_readPos = BlockAt(0).byteBegin;
+
+    // ԍÂւ̂ŃLbV킹
+    if (m_cursorIndex >= 0) {
+        m_cursorIndex -= BLOCK_SAMPLES;
+    }
+    return true;
+}
@@ -0,0 +1,86 @@
+/*****************************************************************//**
+ * \file   input_history.h
+ * \brief  ͗ikEt̃Oobt@j
+ *
+ * Tv BLOCK_SAMPLES Ƃ̃ubNɕA擪
+ * L[t[ƂĂ̂܂܎Ac͑OTvƂ̍
+ * input_codec̍R[hiȂjŃOɏBeʂȂȂÂubN
+ * ۂƎ̂Ă̂ŁAgp Initialize() Ō߂ʂ𒴂ȂB
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "input_codec.h"
+
+//==============================================================================
+// ͗NX
+//==============================================================================
+class InputHistory {
+public:
+    // 1ubÑTv
+    static constexpr int BLOCK_SAMPLES = 256;
+
+    InputHistory() = default;
+    ~InputHistory() { Finalize(); }
+    InputHistory(const InputHistory&) = delete;
+    InputHistory& operator=(const InputHistory&) = delete;
+
+    //==========================================================================
+    // EI
+    //==========================================================================
+    // memoryBytes: f[^p̃Oeʁi2ׂ̂ɐ؂グj
+    bool Initialize(size_t memoryBytes = 1024 * 1024);
+    void Finalize();
+    void Clear();
+
+    //==========================================================================
+    // ǉE擾
+    //==========================================================================
+    void Push(const InputSample& sample);
+
+    // ێĂTvi0ŌÁAGetCount()-1ŐVj
+    int GetCount() const { return m_count; }
+    bool GetSample(int index, InputSample* pSample);
+
+    // w莞ȑOōłVTv̔ԍiȂ0j
+    int FindIndexByTime(uint64_t timeUs);
+
+    // ۂɎgĂ鍷f[^̃oCg
+    size_t GetUsedBytes() const { return m_writePos - m_readPos; }
+    size_t GetCapacityBytes() const { return m_capacity; }
+
+private:
+    // ubNiL[t[{f[^̈ʒuj
+    struct Block {
+        InputSample keyframe;
+        size_t byteBegin = 0;   // O̒ʂʒui}XNOj
+        int sampleCount = 0;
+    };
+
+    bool EvictOldestBlock();
+
+    Block& BlockAt(int index) { return m_pBlocks[(m_firstBlock + index) % m_maxBlocks]; }
+
+    // f[^̃Oieʂ2ׂ̂Aʒu͒ʂԍŊǗj
+    uint8_t* m_pRing = nullptr;
+    size_t m_capacity = 0;
+    size_t m_readPos = 0;
+    size_t m_writePos = 0;
+
+    // ubÑO
+    Block* m_pBlocks = nullptr;
+    int m_maxBlocks = 0;
+    int m_firstBlock = 0;
+    int m_blockCount = 0;
+
+    int m_count = 0;
+    InputEncoder m_encoder;
+
+    // AANZXp̃fR[hʒuLbV
+    int m_cursorIndex = -1;
+    size_t m_cursorPos = 0;
+    InputDecoder m_cursorDecoder;
+    InputSample m_cursorSample;
+};
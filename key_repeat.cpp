@@ -0,0 +1,94 @@
+/*****************************************************************//**
+ * \file   key_repeat.cpp
+ * \brief  j[p̃L[s[gi\L[ƃXeBbNj
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "key_repeat.h"
+#include "gamepad_state.h"
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // \L[̃rbg
+    constexpr uint32_t DPAD_MASK = PAD_BUTTON_DPAD_UP | PAD_BUTTON_DPAD_DOWN |
+        PAD_BUTTON_DPAD_LEFT | PAD_BUTTON_DPAD_RIGHT;
+
+    // őliOj
+    template<typename T>
+    T Max(T a, T b) {
+        return (a > b) ? a : b;
+    }
+}
+
+//==============================================================================
+// 
+//==============================================================================
+void KeyRepeat::Reset() {
+    m_stick = 0;
+    m_held = 0;
+    m_events = 0;
+    for (int i = 0; i < DIRECTION_COUNT; i++) {
+        m_eventCount[i] = 0;
+        m_nextTime[i] = 0;
+        m_interval[i] = 0;
+    }
+}
+
+//==============================================================================
+// XeBbNɕϊix͉̂l܂Ŗ߂܂ŕۂj
+//==============================================================================
+uint32_t KeyRepeat::StickDirections(float stickX, float stickY) const {
+    const float values[DIRECTION_COUNT] = { -stickY, stickY, -stickX, stickX };
+    uint32_t directions = 0;
+    for (int i = 0; i < DIRECTION_COUNT; i++) {
+        uint32_t bit = 1u << i;
+        float threshold = (m_stick & bit) ? m_settings.stickRelease : m_settings.stickPress;
+        if (values[i] >= threshold) {
+            directions |= bit;
+        }
+    }
+    return directions;
+}
+
+//==============================================================================
+// XV
+//==============================================================================
+void KeyRepeat::Update(uint32_t dpad, float stickX, float stickY, uint64_t timeUs) {
+    m_stick = StickDirections(stickX, stickY);
+    uint32_t held = (dpad & DPAD_MASK) | m_stick;
+    uint32_t pressed = held & ~m_held;
+    m_held = held;
+    m_events = 0;
+
+    for (int i = 0; i < DIRECTION_COUNT; i++) {
+        uint32_t bit = 1u << i;
+        m_eventCount[i] = 0;
+        if ((held & bit) == 0) {
+            continue;
+        }
+
+        if (pressed & bit) {
+            // uԂ1Aŏ̌JԂ͏҂
+            m_eventCount[i] = 1;
+            m_nextTime[i] = timeUs + m_settings.initialDelayUs;
+            m_interval[i] = m_settings.intervalUs;
+        } else {
+            // Õt[߂JԂ̐o
+            while (timeUs >= m_nextTime[i] && m_eventCount[i] < MAX_REPEATS_PER_UPDATE) {
+                m_eventCount[i]++;
+                m_nextTime[i] += m_interval[i];
+                m_interval[i] = Max(m_interval[i] * m_settings.accelPercent / 100, m_settings.minIntervalUs);
+            }
+            // őł؂A܂͎̂Ăč琔
+            if (timeUs >= m_nextTime[i]) {
+                m_nextTime[i] = timeUs + m_interval[i];
+            }
+        }
+
+        if (m_eventCount[i] > 0) {
+            m_events |= bit;
+        }
+    }
+}
@@ -0,0 +1,77 @@
+/*****************************************************************//**
+ * \file   key_repeat.h
+ * \brief  j[p̃L[s[gi\L[ƃXeBbNj
+ *
+ * \L[ƁAlŕɕϊXeBbN킹āA
+ * uԂ1A莞ԉƈԊuŌJԂCxgoB
+ * JԂтɊԊuk߂ĉAŎ~߂B
+ *
+ * ̓t[ł͂ȂōsBɏoԊui߂ĂA
+ * 1t[̊Ԃɕ񕪂̎߂Ă΂̉񐔂𐔂̂ŁA
+ * 30fpsł240fpsłԉΓ񐔂iށB
+ *
+ * PAD_BUTTON_DPAD_*̃rbgŕ\B
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+
+//==============================================================================
+// s[gݒ
+//==============================================================================
+struct KeyRepeatSettings {
+    uint64_t initialDelayUs = 400000;   // Ăŏ̌JԂ܂
+    uint64_t intervalUs = 80000;        // ŏ̌JԂԊu
+    uint64_t minIntervalUs = 40000;     // Ƃ̊Ԋủ
+    int accelPercent = 90;              // JԂтɊԊuɊ|銄i100ŉȂj
+    float stickPress = 0.5f;            // XeBbNƂ݂Ȃ|
+    float stickRelease = 0.35f;         // |i`h~j
+};
+
+//==============================================================================
+// L[s[gNX
+//==============================================================================
+class KeyRepeat {
+public:
+    // 1t[ŐJԂ̏i~̌ɂ܂Ƃ߂Đi݂Ȃ悤Ɂj
+    static constexpr int MAX_REPEATS_PER_UPDATE = 8;
+
+    KeyRepeat() { Reset(); }
+
+    void Reset();
+    void SetSettings(const KeyRepeatSettings& settings) { m_settings = settings; }
+    const KeyRepeatSettings& GetSettings() const { return m_settings; }
+
+    // dpadPAD_BUTTON_DPAD_*AXeBbN̓fR[h̒liY͏オj
+    void Update(uint32_t dpad, float stickX, float stickY, uint64_t timeUs);
+
+    // ̃t[ŃCxgoiPAD_BUTTON_DPAD_*̃rbgj
+    uint32_t GetEvents() const { return m_events; }
+    // ̃t[̃Cxg񐔁idirectionPAD_BUTTON_DPAD_*1j
+    int GetEventCount(uint32_t direction) const { return m_eventCount[DirectionIndex(direction)]; }
+    // Ăi\L[ƃXeBbN킹́j
+    uint32_t GetHeld() const { return m_held; }
+
+private:
+    static constexpr int DIRECTION_COUNT = 4;
+
+    // ㉺ȄiPAD_BUTTON_DPAD_UP ~ RIGHT̃rbgƓj
+    static int DirectionIndex(uint32_t direction) {
+        int index = 0;
+        while (index < DIRECTION_COUNT - 1 && (direction & (1u << index)) == 0) {
+            index++;
+        }
+        return index;
+    }
+
+    uint32_t StickDirections(float stickX, float stickY) const;
+
+    KeyRepeatSettings m_settings;
+    uint32_t m_stick;                           // XeBbN瓾
+    uint32_t m_held;
+    uint32_t m_events;
+    int m_eventCount[DIRECTION_COUNT];
+    uint64_t m_nextTime[DIRECTION_COUNT];       // ɌJԂ
+    uint64_t m_interval[DIRECTION_COUNT];       // ݂̌JԂԊu
+};
@@ -0,0 +1,411 @@
+/*****************************************************************//**
+ * \file   keyboard_source.cpp
+ * \brief  L[{[hQ[pbhƂĎg̓\[X
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "keyboard_source.h"
+
+#ifdef _WIN32
+#include "game_controller.h"
+#else
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+//==============================================================================
+// ̊蓖
+//==============================================================================
+const KeyBinding DEFAULT_KEY_BINDINGS[] = {
+    // XeBbNiWASDj
+    { 'w', KEY_TARGET_LEFT_STICK_Y, 1 },
+    { 's', KEY_TARGET_LEFT_STICK_Y, -1 },
+    { 'a', KEY_TARGET_LEFT_STICK_X, -1 },
+    { 'd', KEY_TARGET_LEFT_STICK_X, 1 },
+    // EXeBbNiTFGHj
+    { 't', KEY_TARGET_RIGHT_STICK_Y, 1 },
+    { 'g', KEY_TARGET_RIGHT_STICK_Y, -1 },
+    { 'f', KEY_TARGET_RIGHT_STICK_X, -1 },
+    { 'h', KEY_TARGET_RIGHT_STICK_X, 1 },
+    // \L[
+    { KEYBOARD_KEY_UP, KEY_TARGET_BUTTON, PAD_BUTTON_DPAD_UP },
+    { KEYBOARD_KEY_DOWN, KEY_TARGET_BUTTON, PAD_BUTTON_DPAD_DOWN },
+    { KEYBOARD_KEY_LEFT, KEY_TARGET_BUTTON, PAD_BUTTON_DPAD_LEFT },
+    { KEYBOARD_KEY_RIGHT, KEY_TARGET_BUTTON, PAD_BUTTON_DPAD_RIGHT },
+    // ʃ{^i1 ~ 4ƃXy[Xj
+    { '1', KEY_TARGET_BUTTON, PAD_BUTTON_A },
+    { '2', KEY_TARGET_BUTTON, PAD_BUTTON_B },
+    { '3', KEY_TARGET_BUTTON, PAD_BUTTON_X },
+    { '4', KEY_TARGET_BUTTON, PAD_BUTTON_Y },
+    { KEYBOARD_KEY_SPACE, KEY_TARGET_BUTTON, PAD_BUTTON_A },
+    // V_[EgK[EXeBbN
+    { 'q', KEY_TARGET_BUTTON, PAD_BUTTON_LEFT_SHOULDER },
+    { 'e', KEY_TARGET_BUTTON, PAD_BUTTON_RIGHT_SHOULDER },
+    { 'z', KEY_TARGET_LEFT_TRIGGER, 0 },
+    { 'x', KEY_TARGET_RIGHT_TRIGGER, 0 },
+    { 'n', KEY_TARGET_BUTTON, PAD_BUTTON_LEFT_THUMB },
+    { 'm', KEY_TARGET_BUTTON, PAD_BUTTON_RIGHT_THUMB },
+    // VXe{^
+    { KEYBOARD_KEY_ENTER, KEY_TARGET_BUTTON, PAD_BUTTON_START },
+    { KEYBOARD_KEY_TAB, KEY_TARGET_BUTTON, PAD_BUTTON_BACK },
+};
+const int DEFAULT_KEY_BINDING_COUNT = sizeof(DEFAULT_KEY_BINDINGS) / sizeof(DEFAULT_KEY_BINDINGS[0]);
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // ̕сim_axes̓YAKEY_TARGET_LEFT_STICK_X珇j
+    constexpr int AXIS_LEFT_TRIGGER = KEY_TARGET_LEFT_TRIGGER - KEY_TARGET_LEFT_STICK_X;
+    constexpr int AXIS_RIGHT_TRIGGER = KEY_TARGET_RIGHT_TRIGGER - KEY_TARGET_LEFT_STICK_X;
+
+    constexpr float STICK_MAX = 32767.0f;
+    constexpr float TRIGGER_MAX = 255.0f;
+
+    // xɓǂރCxgEoCg
+    constexpr int READ_CHUNK = 64;
+
+    // [FESČɑ͂ȂESCL[P̂Ƃ݂Ȃ܂ł̎
+    constexpr uint64_t ESCAPE_WAIT_US = 50000;
+
+    // l̊ۂ߁iľܓj
+    int16_t ToStick(float value) {
+        float scaled = value * STICK_MAX;
+        return static_cast<int16_t>((scaled < 0.0f) ? scaled - 0.5f : scaled + 0.5f);
+    }
+
+    // ̃L[R[hɑ
+    int NormalizeCharKey(int ch) {
+        if (ch >= 'A' && ch <= 'Z') return ch - 'A' + 'a';
+        if (ch == '\n') return KEYBOARD_KEY_ENTER;
+        return ch;
+    }
+}
+
+#ifdef _WIN32
+KeyboardSource* KeyboardSource::s_pRegistered = nullptr;
+#endif
+
+//==============================================================================
+// 
+//==============================================================================
+KeyboardSource::KeyboardSource() {
+    for (int i = 0; i < KEYBOARD_KEY_COUNT; i++) {
+        m_isDown[i] = false;
+        m_holdUntil[i] = 0;
+    }
+    SetBindings(DEFAULT_KEY_BINDINGS, DEFAULT_KEY_BINDING_COUNT);
+}
+
+void KeyboardSource::SetBindings(const KeyBinding* pBindings, int count) {
+    m_bindingCount = 0;
+    for (int i = 0; i < count && m_bindingCount < MAX_BINDINGS; i++) {
+        if (pBindings[i].key >= 0 && pBindings[i].key < KEYBOARD_KEY_COUNT) {
+            m_bindings[m_bindingCount++] = pBindings[i];
+        }
+    }
+}
+
+//==============================================================================
+// XV
+//==============================================================================
+void KeyboardSource::Update(uint64_t timeUs) {
+    if (m_isOpen) {
+        ReadEvents(timeUs);
+    }
+
+    // ʒmȂ΁A܂܂Ƃ݂ȂԂ߂L[𗣂
+    if (!m_hasReleaseEvents) {
+        for (int key = 0; key < KEYBOARD_KEY_COUNT; key++) {
+            if (m_isDown[key] && timeUs >= m_holdUntil[key]) {
+                m_isDown[key] = false;
+            }
+        }
+    }
+
+    UpdateAxes(timeUs);
+}
+
+void KeyboardSource::InjectKey(int key, bool isDown, uint64_t timeUs) {
+    if (key < 0 || key >= KEYBOARD_KEY_COUNT) {
+        return;
+    }
+    if (!isDown) {
+        m_isDown[key] = false;
+        return;
+    }
+
+    // ςȂ̂Ƃ֓͂L[s[g
+    m_holdUntil[key] = timeUs + (m_isDown[key] ? m_settings.repeatHoldUs : m_settings.initialHoldUs);
+    m_isDown[key] = true;
+
+    if (m_queueCount < KEY_QUEUE_SIZE) {
+        m_keyQueue[(m_queueHead + m_queueCount) % KEY_QUEUE_SIZE] = key;
+        m_queueCount++;
+    }
+}
+
+int KeyboardSource::PopKey() {
+    if (m_queueCount == 0) {
+        return -1;
+    }
+    int key = m_keyQueue[m_queueHead];
+    m_queueHead = (m_queueHead + 1) % KEY_QUEUE_SIZE;
+    m_queueCount--;
+    return key;
+}
+
+//==============================================================================
+// ĂL[琶̒l
+//==============================================================================
+void KeyboardSource::UpdateAxes(uint64_t timeUs) {
+    uint64_t elapsedUs = (m_hasUpdated && timeUs > m_lastUpdateTime) ? timeUs - m_lastUpdateTime : 0;
+    m_lastUpdateTime = timeUs;
+    m_hasUpdated = true;
+
+    uint16_t buttons = 0;
+    int direction[AXIS_COUNT] = {};
+    for (int i = 0; i < m_bindingCount; i++) {
+        const KeyBinding& binding = m_bindings[i];
+        if (!m_isDown[binding.key]) {
+            continue;
+        }
+        if (binding.target == KEY_TARGET_BUTTON) {
+            buttons |= static_cast<uint16_t>(binding.value);
+        } else {
+            int axis = binding.target - KEY_TARGET_LEFT_STICK_X;
+            direction[axis] += (axis >= AXIS_LEFT_TRIGGER) ? 1 : binding.value;
+        }
+    }
+
+    for (int axis = 0; axis < AXIS_COUNT; axis++) {
+        // Ό𗼕0AgK[͉Ă1
+        int sign = (direction[axis] > 0) ? 1 : ((direction[axis] < 0) ? -1 : 0);
+        float target = (axis >= AXIS_LEFT_TRIGGER) ? static_cast<float>(sign) : sign * m_settings.stickScale;
+        m_axes[axis] = MoveToward(m_axes[axis], target, elapsedUs);
+    }
+
+    m_gamepad.buttons = buttons;
+    m_gamepad.thumbLX = ToStick(m_axes[0]);
+    m_gamepad.thumbLY = ToStick(m_axes[1]);
+    m_gamepad.thumbRX = ToStick(m_axes[2]);
+    m_gamepad.thumbRY = ToStick(m_axes[3]);
+    m_gamepad.leftTrigger = static_cast<uint8_t>(m_axes[AXIS_LEFT_TRIGGER] * TRIGGER_MAX + 0.5f);
+    m_gamepad.rightTrigger = static_cast<uint8_t>(m_axes[AXIS_RIGHT_TRIGGER] * TRIGGER_MAX + 0.5f);
+}
+
+// 0痣rampUpUsA0֖߂rampDownUsőSi1.0j𓮂
+// Ό֐؂ւƂ́A0Ŏ~߂Ă玟̍XVœ|n߂
+float KeyboardSource::MoveToward(float current, float target, uint64_t elapsedUs) const {
+    if (current == target) {
+        return current;
+    }
+    bool isAway = (target > current) ? (current >= 0.0f) : (current <= 0.0f);
+    uint64_t rampUs = isAway ? m_settings.rampUpUs : m_settings.rampDownUs;
+    if (!isAway && current * target < 0.0f) {
+        target = 0.0f;
+    }
+    if (rampUs == 0) {
+        return target;
+    }
+
+    float step = static_cast<float>(elapsedUs) / static_cast<float>(rampUs);
+    if (target > current) {
+        return (current + step < target) ? current + step : target;
+    }
+    return (current - step > target) ? current - step : target;
+}
+
+#ifdef _WIN32
+//==============================================================================
+// R\[́iWindowsj
+//==============================================================================
+namespace {
+    // zL[R[hL[R[hցiΏۊO-1j
+    int TranslateVirtualKey(WORD virtualKey) {
+        if ((virtualKey >= 'A' && virtualKey <= 'Z') || (virtualKey >= '0' && virtualKey <= '9')) {
+            return NormalizeCharKey(virtualKey);
+        }
+        switch (virtualKey) {
+        case VK_TAB: return KEYBOARD_KEY_TAB;
+        case VK_RETURN: return KEYBOARD_KEY_ENTER;
+        case VK_ESCAPE: return KEYBOARD_KEY_ESCAPE;
+        case VK_SPACE: return KEYBOARD_KEY_SPACE;
+        case VK_HOME: return KEYBOARD_KEY_HOME;
+        case VK_END: return KEYBOARD_KEY_END;
+        case VK_UP: return KEYBOARD_KEY_UP;
+        case VK_DOWN: return KEYBOARD_KEY_DOWN;
+        case VK_LEFT: return KEYBOARD_KEY_LEFT;
+        case VK_RIGHT: return KEYBOARD_KEY_RIGHT;
+        default: return -1;
+        }
+    }
+}
+
+bool KeyboardSource::Open() {
+    Close();
+    HANDLE hInput = GetStdHandle(STD_INPUT_HANDLE);
+    DWORD mode = 0;
+    if (hInput == INVALID_HANDLE_VALUE || !GetConsoleMode(hInput, &mode)) {
+        return false;
+    }
+    // śEGR[~߂iCtrl+C͎cj
+    SetConsoleMode(hInput, mode & ~(ENABLE_LINE_INPUT | ENABLE_ECHO_INPUT));
+    m_hInput = hInput;
+    m_savedMode = mode;
+    m_hasReleaseEvents = true;
+    m_isOpen = true;
+    return true;
+}
+
+void KeyboardSource::Close() {
+    if (!m_isOpen) {
+        return;
+    }
+    SetConsoleMode(m_hInput, m_savedMode);
+    m_hInput = nullptr;
+    m_isOpen = false;
+}
+
+void KeyboardSource::ReadEvents(uint64_t timeUs) {
+    DWORD pending = 0;
+    while (GetNumberOfConsoleInputEvents(m_hInput, &pending) && pending > 0) {
+        INPUT_RECORD records[READ_CHUNK];
+        DWORD count = 0;
+        if (!ReadConsoleInputA(m_hInput, records, READ_CHUNK, &count) || count == 0) {
+            return;
+        }
+        for (DWORD i = 0; i < count; i++) {
+            if (records[i].EventType != KEY_EVENT) {
+                continue;
+            }
+            const KEY_EVENT_RECORD& event = records[i].Event.KeyEvent;
+            int key = TranslateVirtualKey(event.wVirtualKeyCode);
+            if (key >= 0) {
+                InjectKey(key, event.bKeyDown != FALSE, timeUs);
+            }
+        }
+    }
+}
+
+//==============================================================================
+// GameController::SetStateSource()p
+//==============================================================================
+DWORD WINAPI KeyboardSource::GetStateFor(DWORD userIndex, XINPUT_STATE* pState) {
+    KeyboardSource* pSource = s_pRegistered;
+    if (userIndex != 0 || pSource == nullptr) {
+        return ERROR_DEVICE_NOT_CONNECTED;
+    }
+    pSource->Update(GameController::GetUpdateTime());
+
+    const RawGamepad& pad = pSource->GetGamepad();
+    ZeroMemory(pState, sizeof(XINPUT_STATE));
+    pState->Gamepad.wButtons = pad.buttons;
+    pState->Gamepad.bLeftTrigger = pad.leftTrigger;
+    pState->Gamepad.bRightTrigger = pad.rightTrigger;
+    pState->Gamepad.sThumbLX = pad.thumbLX;
+    pState->Gamepad.sThumbLY = pad.thumbLY;
+    pState->Gamepad.sThumbRX = pad.thumbRX;
+    pState->Gamepad.sThumbRY = pad.thumbRY;
+    return ERROR_SUCCESS;
+}
+
+#else
+//==============================================================================
+// [́iLinuxEPOSIXj
+//==============================================================================
+bool KeyboardSource::Open() {
+    Close();
+    m_savedFlags = fcntl(STDIN_FILENO, F_GETFL);
+    if (m_savedFlags < 0) {
+        return false;
+    }
+
+    // [Ȃ1oCgAGR[ȂœǂށiCtrl+C̃VOi͎cj
+    // pCvEt@C͂̂܂ܓǂ
+    m_isTerminal = isatty(STDIN_FILENO) && tcgetattr(STDIN_FILENO, &m_savedTermios) == 0;
+    if (m_isTerminal) {
+        termios raw = m_savedTermios;
+        raw.c_lflag &= ~(ICANON | ECHO);
+        raw.c_cc[VMIN] = 0;
+        raw.c_cc[VTIME] = 0;
+        if (tcsetattr(STDIN_FILENO, TCSANOW, &raw) < 0) {
+            return false;
+        }
+    }
+    fcntl(STDIN_FILENO, F_SETFL, m_savedFlags | O_NONBLOCK);
+
+    m_escapeLength = 0;
+    m_hasReleaseEvents = false;
+    m_isOpen = true;
+    return true;
+}
+
+void KeyboardSource::Close() {
+    if (!m_isOpen) {
+        return;
+    }
+    if (m_isTerminal) {
+        tcsetattr(STDIN_FILENO, TCSANOW, &m_savedTermios);
+    }
+    fcntl(STDIN_FILENO, F_SETFL, m_savedFlags);
+    m_isOpen = false;
+}
+
+void KeyboardSource::ReadEvents(uint64_t timeUs) {
+    uint8_t buffer[sizeof(m_escape) + READ_CHUNK];
+    for (;;) {
+        // O̓ǂݍ݂̍Ōœr؂ꂽGXP[vV[PX擪ɖ߂
+        int carried = m_escapeLength;
+        memcpy(buffer, m_escape, carried);
+        ssize_t length = read(STDIN_FILENO, buffer + carried, READ_CHUNK);
+        if (length <= 0) {
+            // Ȃ܂܎Ԃ߂AESCL[Ṕi'['Ȃǂ̕j
+            if (m_escapeLength > 0 && timeUs >= m_escapeTime + ESCAPE_WAIT_US) {
+                for (int i = 0; i < m_escapeLength; i++) {
+                    InjectKey(NormalizeCharKey(m_escape[i]), true, timeUs);
+                }
+                m_escapeLength = 0;
+            }
+            return;
+        }
+        length += carried;
+        m_escapeLength = 0;
+
+        for (ssize_t i = 0; i < length; i++) {
+            int key = NormalizeCharKey(buffer[i]);
+
+            // ȂǂESC [ xiESC O xjœ͂AȂESCL[P
+            if (buffer[i] == KEYBOARD_KEY_ESCAPE) {
+                ssize_t rest = length - i;
+                bool isIntroducer = rest >= 2 && (buffer[i + 1] == '[' || buffer[i + 1] == 'O');
+                if (rest == 1 || (rest == 2 && isIntroducer)) {
+                    // ẑ܂zƂ͍ŏɓ͂̂܂
+                    if (!(carried > 0 && i == 0)) {
+                        m_escapeTime = timeUs;
+                    }
+                    memcpy(m_escape, buffer + i, static_cast<size_t>(rest));
+                    m_escapeLength = static_cast<int>(rest);
+                    break;
+                }
+                if (isIntroducer) {
+                    switch (buffer[i + 2]) {
+                    case 'A': key = KEYBOARD_KEY_UP; break;
+                    case 'B': key = KEYBOARD_KEY_DOWN; break;
+                    case 'C': key = KEYBOARD_KEY_RIGHT; break;
+                    case 'D': key = KEYBOARD_KEY_LEFT; break;
+                    case 'H': key = KEYBOARD_KEY_HOME; break;
+                    case 'F': key = KEYBOARD_KEY_END; break;
+                    default: key = -1; break;
+                    }
+                    i += 2;
+                }
+            }
+            if (key >= 0) {
+                InjectKey(key, true, timeUs);
+            }
+        }
+    }
+}
+#endif
@@ -0,0 +1,170 @@
+/*****************************************************************//**
+ * \file   keyboard_source.h
+ * \brief  L[{[hQ[pbhƂĎg̓\[X
+ *
+ * pbĥȂJ@Linux̃rhG[WFgŁAL[{[h
+ * RawGamepadBL[͊蓖ĕ\Ń{^EXeBbNEgK[
+ * U蕪AXeBbNƃgK[͐ݒ肵Ԃ0[܂Ŋ炩ɓB
+ * ̂̓fR[hO̐̒lȂ̂ŁAfbh][EuԂ̔Ȃǂ
+ * {̃pbhƓʂB
+ *
+ *   Windows : R\[͂̃CxgiE͂j
+ *   Linux   : [raw[hɂĕW͂ǂ
+ *             ʒmȂ̂ŁAL[s[gr؂ꂽ痣Ƃ݂Ȃ
+ *
+ * GameControllerւGetStateFor()̓\[XƂēn
+ * iLogicalPlayer̃\[Xɂ΃pbhƍ킹ĎgjB
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "gamepad_state.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <Xinput.h>
+#else
+#include <termios.h>
+#endif
+
+//==============================================================================
+// L[R[hi͏ASCIIAL[_getch()̊gR[h{256Ɠlj
+//==============================================================================
+constexpr int KEYBOARD_KEY_TAB = 9;
+constexpr int KEYBOARD_KEY_ENTER = 13;
+constexpr int KEYBOARD_KEY_ESCAPE = 27;
+constexpr int KEYBOARD_KEY_SPACE = 32;
+constexpr int KEYBOARD_KEY_HOME = 256 + 71;
+constexpr int KEYBOARD_KEY_UP = 256 + 72;
+constexpr int KEYBOARD_KEY_LEFT = 256 + 75;
+constexpr int KEYBOARD_KEY_RIGHT = 256 + 77;
+constexpr int KEYBOARD_KEY_END = 256 + 79;
+constexpr int KEYBOARD_KEY_DOWN = 256 + 80;
+constexpr int KEYBOARD_KEY_COUNT = 512;
+
+//==============================================================================
+// 蓖
+//==============================================================================
+enum KeyTarget {
+    KEY_TARGET_BUTTON,          // valuePAD_BUTTON_*
+    KEY_TARGET_LEFT_STICK_X,    // value+1-1iY͏オ+1AXInputƓj
+    KEY_TARGET_LEFT_STICK_Y,
+    KEY_TARGET_RIGHT_STICK_X,
+    KEY_TARGET_RIGHT_STICK_Y,
+    KEY_TARGET_LEFT_TRIGGER,    // value͎gȂ
+    KEY_TARGET_RIGHT_TRIGGER,
+};
+
+struct KeyBinding {
+    int key;                    // KEYBOARD_KEY_*ASCII
+    KeyTarget target;
+    int value;
+};
+
+// ̊蓖āiWASDETFGHŃXeBbNAŏ\L[A1 ~ 4Ŗʃ{^Ȃǁj
+extern const KeyBinding DEFAULT_KEY_BINDINGS[];
+extern const int DEFAULT_KEY_BINDING_COUNT;
+
+//==============================================================================
+// ݒ
+//==============================================================================
+struct KeyboardSourceSettings {
+    uint64_t rampUpUs = 120000;     // XeBbNEgK[0[܂œԁi0łj
+    uint64_t rampDownUs = 60000;    // [0֖߂
+    float stickScale = 1.0f;        // |ʁi1.0Œ[܂Łj
+
+    // ʒmȂƂiLinuxjɉ܂܂Ƃ݂Ȃ
+    uint64_t initialHoldUs = 550000;    // ŏ̉iL[s[gn܂܂ł蒷j
+    uint64_t repeatHoldUs = 120000;     // s[g͂Ăԁis[gԊu蒷j
+};
+
+//==============================================================================
+// L[{[h̓\[XNX
+//==============================================================================
+class KeyboardSource {
+public:
+    static constexpr int MAX_BINDINGS = 64;
+    // 蓖ĂɊ֌WȂĂL[̐
+    static constexpr int KEY_QUEUE_SIZE = 32;
+
+    KeyboardSource();
+    ~KeyboardSource() { Close(); }
+    KeyboardSource(const KeyboardSource&) = delete;
+    KeyboardSource& operator=(const KeyboardSource&) = delete;
+
+    // [ER\[͗pɐ؂ւiWindows͕W͂R\[łȂfalseA
+    // Linux͒[łȂĂpCvȂǂǂށrhG[WFgŃL[͂𗬂߂j
+    bool Open();
+    // ̐ݒɖ߂
+    void Close();
+    bool IsOpen() const { return m_isOpen; }
+
+    void SetBindings(const KeyBinding* pBindings, int count);
+    void SetSettings(const KeyboardSourceSettings& settings) { m_settings = settings; }
+    const KeyboardSourceSettings& GetSettings() const { return m_settings; }
+
+    // ͂L[͂ǂ݁AĂL[琶̒l
+    void Update(uint64_t timeUs);
+    // L[𒼐ډEieXg⑼̓͂̒pAUpdateŔfj
+    void InjectKey(int key, bool isDown, uint64_t timeUs);
+
+    const RawGamepad& GetGamepad() const { return m_gamepad; }
+    bool IsKeyDown(int key) const { return key >= 0 && key < KEYBOARD_KEY_COUNT && m_isDown[key]; }
+
+    // ꂽL[ÂɎoiȂ-1A蓖Ă̂L[j
+    // R\[͂͂̃NXǂނ̂ŁAzbgL[͂炩󂯎
+    int PopKey();
+
+#ifdef _WIN32
+    //==========================================================================
+    // GameController::SetStateSource()piGameController::GetUpdateTime()j
+    //==========================================================================
+    static DWORD WINAPI GetStateFor(DWORD userIndex, XINPUT_STATE* pState);
+    // userIndex 0Ƃēǂރ\[XinullptrŊOj
+    static void Register(KeyboardSource* pSource) { s_pRegistered = pSource; }
+#endif
+
+private:
+    void ReadEvents(uint64_t timeUs);
+    void UpdateAxes(uint64_t timeUs);
+    float MoveToward(float current, float target, uint64_t elapsedUs) const;
+
+    KeyboardSourceSettings m_settings;
+    KeyBinding m_bindings[MAX_BINDINGS];
+    int m_bindingCount = 0;
+
+    // L[Ƃ̏ԁiʒmȂƂm_holdUntil߂痣j
+    bool m_isDown[KEYBOARD_KEY_COUNT];
+    uint64_t m_holdUntil[KEYBOARD_KEY_COUNT];
+    bool m_hasReleaseEvents = false;
+
+    int m_keyQueue[KEY_QUEUE_SIZE];
+    int m_queueHead = 0;
+    int m_queueCount = 0;
+
+    // XeBbN4EgK[2̌ݒli-1.0 ~ 1.0AgK[0.0 ~ 1.0j
+    static constexpr int AXIS_COUNT = 6;
+    float m_axes[AXIS_COUNT] = {};
+    uint64_t m_lastUpdateTime = 0;
+    bool m_hasUpdated = false;
+
+    RawGamepad m_gamepad;
+    bool m_isOpen = false;
+
+#ifdef _WIN32
+    void* m_hInput = nullptr;
+    DWORD m_savedMode = 0;
+    static KeyboardSource* s_pRegistered;
+#else
+    int m_savedFlags = 0;
+    bool m_isTerminal = false;
+    termios m_savedTermios;
+
+    // ǂݍ݂̐؂ڂœr؂ꂽGXP[vV[PXiESCAESC [j̓ǂݍ݂֎z
+    uint8_t m_escape[2] = {};
+    int m_escapeLength = 0;
+    uint64_t m_escapeTime = 0;
+#endif
+};
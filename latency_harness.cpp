@@ -0,0 +1,342 @@
+/*****************************************************************//**
+ * \file   latency_harness.cpp
+ * \brief  ͒x̉AeXgn[lX
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+
+ // Windows.hmin/max}N𖳌
+#define NOMINMAX
+#include "latency_harness.h"
+#include "game_controller.h"
+#include <cstdio>
+#include <vector>
+#include <algorithm>
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    constexpr ULONGLONG MICROSECONDS_PER_SECOND = 1000000ULL;
+
+    // W̏\
+    constexpr int FRAME_RATES[] = { 30, 60, 144, 240 };
+    constexpr int POLL_RATES[] = { 125, 250, 500, 1000 };
+    constexpr int FRAME_RATE_COUNT = sizeof(FRAME_RATES) / sizeof(FRAME_RATES[0]);
+    constexpr int POLL_RATE_COUNT = sizeof(POLL_RATES) / sizeof(POLL_RATES[0]);
+    constexpr int MAX_BASELINE_ENTRIES = 64;
+
+    // AƂ݂Ȃi{Βlj
+    constexpr double REGRESSION_RATIO = 1.05;
+    constexpr double REGRESSION_MARGIN_MS = 0.1;
+
+    // 1̉
+    struct InjectedPress {
+        ULONGLONG pressTime;
+        ULONGLONG releaseTime;
+    };
+
+    //==========================================================================
+    // foCX
+    // XPW[A|[OƂɂԂXV
+    //==========================================================================
+    struct SyntheticDevice {
+        const InjectedPress* pPresses = nullptr;
+        int pressCount = 0;
+        ULONGLONG pollPeriod = 0;
+        ULONGLONG pollPhase = 0;
+        DWORD packetNumber = 0;
+        bool lastPressed = false;
+    };
+
+    SyntheticDevice s_device;
+    ULONGLONG s_virtualTime = 0;
+
+    // ixorshift32AnɈˑȂʂɂ邽ߎOj
+    unsigned int NextRandom(unsigned int* pState) {
+        unsigned int x = *pState;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        *pState = x;
+        return x;
+    }
+
+    ULONGLONG RandomRange(unsigned int* pState, ULONGLONG minVal, ULONGLONG maxVal) {
+        if (maxVal <= minVal) return minVal;
+        return minVal + NextRandom(pState) % (maxVal - minVal + 1);
+    }
+
+    ULONGLONG SecondsToUs(float seconds) {
+        return static_cast<ULONGLONG>(seconds * 1000000.0f);
+    }
+
+    // z
+    ULONGLONG VirtualClock() {
+        return s_virtualTime;
+    }
+
+    // timeŉĂ邩i񕪒Tj
+    bool IsPressedAt(ULONGLONG time) {
+        int lo = 0;
+        int hi = s_device.pressCount;
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (s_device.pPresses[mid].pressTime <= time) lo = mid + 1;
+            else hi = mid;
+        }
+        if (lo == 0) return false;
+        return time < s_device.pPresses[lo - 1].releaseTime;
+    }
+
+    // XInputGetStatȇɌĂ΂鍇\[X
+    DWORD WINAPI SyntheticGetState(DWORD dwUserIndex, XINPUT_STATE* pState) {
+        if (dwUserIndex != 0) {
+            return ERROR_DEVICE_NOT_CONNECTED;
+        }
+
+        // foCX͒߂̃|[ȌԂ񍐂Ȃ
+        ULONGLONG pollTime = 0;
+        if (s_virtualTime >= s_device.pollPhase) {
+            ULONGLONG ticks = (s_virtualTime - s_device.pollPhase) / s_device.pollPeriod;
+            pollTime = s_device.pollPhase + ticks * s_device.pollPeriod;
+        }
+        bool pressed = (s_virtualTime >= s_device.pollPhase) && IsPressedAt(pollTime);
+
+        if (pressed != s_device.lastPressed) {
+            s_device.lastPressed = pressed;
+            s_device.packetNumber++;
+        }
+
+        ZeroMemory(pState, sizeof(XINPUT_STATE));
+        pState->dwPacketNumber = s_device.packetNumber;
+        pState->Gamepad.wButtons = pressed ? XINPUT_GAMEPAD_A : 0;
+        return ERROR_SUCCESS;
+    }
+
+    // \[gςݔz̕Sʁinearest-rankj
+    double Percentile(const std::vector<ULONGLONG>& sorted, double percent) {
+        if (sorted.empty()) return 0.0;
+        size_t rank = static_cast<size_t>(percent / 100.0 * sorted.size() + 0.999999);
+        if (rank < 1) rank = 1;
+        if (rank > sorted.size()) rank = sorted.size();
+        return sorted[rank - 1] / 1000.0;
+    }
+
+    const LatencyBaselineEntry* FindBaseline(const LatencyBaselineEntry* pEntries, int count,
+        int frameRate, int pollRate) {
+        for (int i = 0; i < count; i++) {
+            if (pEntries[i].frameRate == frameRate && pEntries[i].pollRate == pollRate) {
+                return &pEntries[i];
+            }
+        }
+        return nullptr;
+    }
+}
+
+//==============================================================================
+// 1Ԃ̃eXgs
+//==============================================================================
+bool RunLatencyTest(const LatencyTestConfig& config, LatencyTestResult* pResult) {
+    if (pResult == nullptr || config.frameRate <= 0 || config.pollRate <= 0 || config.pressCount <= 0) {
+        return false;
+    }
+    *pResult = {};
+
+    unsigned int random = (config.seed != 0) ? config.seed : 1;
+    ULONGLONG framePeriod = MICROSECONDS_PER_SECOND / config.frameRate;
+    ULONGLONG pollPeriod = MICROSECONDS_PER_SECOND / config.pollRate;
+    ULONGLONG holdTime = SecondsToUs(config.holdTime);
+
+    // XPW[쐬it[E|[OƂ̈ʑ̓_j
+    std::vector<InjectedPress> presses(config.pressCount);
+    ULONGLONG time = MICROSECONDS_PER_SECOND;
+    for (InjectedPress& press : presses) {
+        time += RandomRange(&random, SecondsToUs(config.intervalMin), SecondsToUs(config.intervalMax));
+        press.pressTime = time;
+        press.releaseTime = time + holdTime;
+        time = press.releaseTime;
+    }
+    ULONGLONG endTime = time + MICROSECONDS_PER_SECOND;
+
+    s_device = {};
+    s_device.pPresses = presses.data();
+    s_device.pressCount = config.pressCount;
+    s_device.pollPeriod = pollPeriod;
+    s_device.pollPhase = RandomRange(&random, 0, pollPeriod - 1);
+
+    // ۂGameController\[XƉzœ
+    s_virtualTime = 0;
+    GameController::SetStateSource(SyntheticGetState);
+    GameController::SetClockSource(VirtualClock);
+    GameController::Initialize();
+
+    std::vector<ULONGLONG> latencies;
+    latencies.reserve(config.pressCount);
+    int nextPress = 0;
+
+    for (s_virtualTime = RandomRange(&random, 0, framePeriod - 1);
+        s_virtualTime < endTime; s_virtualTime += framePeriod) {
+        GameController::Update();
+
+        // Q[̏FuԂϑxL^
+        if (!GameController::IsTrigger_ButtonDown()) {
+            continue;
+        }
+
+        // ݎ܂łɉꂽŌ̉ƑΉtiȑÔ͎̂肱ڂj
+        int matched = -1;
+        while (nextPress < config.pressCount && presses[nextPress].pressTime <= s_virtualTime) {
+            matched = nextPress++;
+        }
+        if (matched < 0) {
+            continue;
+        }
+        latencies.push_back(s_virtualTime - presses[matched].pressTime);
+    }
+
+    GameController::Finalize();
+    GameController::SetStateSource(nullptr);
+    GameController::SetClockSource(nullptr);
+
+    pResult->injected = config.pressCount;
+    pResult->observed = static_cast<int>(latencies.size());
+    pResult->missed = pResult->injected - pResult->observed;
+
+    if (latencies.empty()) {
+        return true;
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    ULONGLONG total = 0;
+    for (ULONGLONG latency : latencies) {
+        total += latency;
+    }
+    pResult->minMs = latencies.front() / 1000.0;
+    pResult->maxMs = latencies.back() / 1000.0;
+    pResult->meanMs = static_cast<double>(total) / latencies.size() / 1000.0;
+    pResult->p50Ms = Percentile(latencies, 50.0);
+    pResult->p95Ms = Percentile(latencies, 95.0);
+    pResult->p99Ms = Percentile(latencies, 99.0);
+    return true;
+}
+
+//==============================================================================
+// x[XCǂݍ
+//==============================================================================
+int LoadLatencyBaseline(const char* pPath, LatencyBaselineEntry* pEntries, int maxEntries) {
+    FILE* pFile = nullptr;
+    if (fopen_s(&pFile, pPath, "r") != 0 || pFile == nullptr) {
+        return 0;
+    }
+
+    int count = 0;
+    char line[128];
+    while (count < maxEntries && fgets(line, sizeof(line), pFile) != nullptr) {
+        if (line[0] == '#') continue;
+        LatencyBaselineEntry entry;
+        if (sscanf_s(line, "%d %d %lf", &entry.frameRate, &entry.pollRate, &entry.p99Ms) == 3) {
+            pEntries[count++] = entry;
+        }
+    }
+
+    fclose(pFile);
+    return count;
+}
+
+//==============================================================================
+// x[XCۑ
+//==============================================================================
+bool SaveLatencyBaseline(const char* pPath, const LatencyBaselineEntry* pEntries, int count) {
+    FILE* pFile = nullptr;
+    if (fopen_s(&pFile, pPath, "w") != 0 || pFile == nullptr) {
+        return false;
+    }
+
+    fprintf(pFile, "# frameRate pollRate p99Ms\n");
+    for (int i = 0; i < count; i++) {
+        fprintf(pFile, "%d %d %.3f\n", pEntries[i].frameRate, pEntries[i].pollRate, pEntries[i].p99Ms);
+    }
+
+    fclose(pFile);
+    return true;
+}
+
+//==============================================================================
+// Wł̉AeXg
+//==============================================================================
+int RunLatencyRegression(const char* pBaselinePath, bool updateBaseline) {
+    LatencyBaselineEntry baseline[MAX_BASELINE_ENTRIES];
+    int baselineCount = updateBaseline ? 0 : LoadLatencyBaseline(pBaselinePath, baseline, MAX_BASELINE_ENTRIES);
+    if (!updateBaseline && baselineCount <= 0) {
+        printf(" No baseline entries in %s (run with --update-baseline to create it)\n\n", pBaselinePath);
+        baselineCount = 0;
+    }
+
+    LatencyBaselineEntry results[MAX_BASELINE_ENTRIES];
+    int resultCount = 0;
+    int failures = 0;
+    // ̂Ȃit@CȂEǂ߂Ȃꍇ܂ށj͊mFłȂ̂ŎsƂĐ
+    int missing = 0;
+
+    printf(" frame  poll |   min    p50    p95    p99    max (ms) | miss | baseline p99\n");
+    printf("-------------+-------------------------------------------+------+-------------\n");
+
+    for (int f = 0; f < FRAME_RATE_COUNT; f++) {
+        for (int p = 0; p < POLL_RATE_COUNT; p++) {
+            LatencyTestConfig config;
+            config.frameRate = FRAME_RATES[f];
+            config.pollRate = POLL_RATES[p];
+
+            LatencyTestResult result;
+            if (!RunLatencyTest(config, &result)) {
+                printf(" %5d %5d | failed to run\n", config.frameRate, config.pollRate);
+                failures++;
+                continue;
+            }
+
+            char verdict[64] = "";
+            const LatencyBaselineEntry* pBase = FindBaseline(baseline, baselineCount,
+                config.frameRate, config.pollRate);
+            if (pBase != nullptr) {
+                bool regressed = result.p99Ms > pBase->p99Ms * REGRESSION_RATIO + REGRESSION_MARGIN_MS;
+                sprintf_s(verdict, sizeof(verdict), "%7.2f %s", pBase->p99Ms, regressed ? "REGRESSED" : "ok");
+                if (regressed) failures++;
+            } else if (!updateBaseline) {
+                sprintf_s(verdict, sizeof(verdict), "    (none) MISSING");
+                missing++;
+            }
+
+            printf(" %5d %5d | %5.2f %6.2f %6.2f %6.2f %6.2f      | %4d | %s\n",
+                config.frameRate, config.pollRate,
+                result.minMs, result.p50Ms, result.p95Ms, result.p99Ms, result.maxMs,
+                result.missed, verdict);
+
+            results[resultCount].frameRate = config.frameRate;
+            results[resultCount].pollRate = config.pollRate;
+            results[resultCount].p99Ms = result.p99Ms;
+            resultCount++;
+        }
+    }
+
+    if (updateBaseline) {
+        if (!SaveLatencyBaseline(pBaselinePath, results, resultCount)) {
+            printf("\n Failed to write baseline: %s\n", pBaselinePath);
+            return 1;
+        }
+        printf("\n Baseline written: %s\n", pBaselinePath);
+        return 0;
+    }
+
+    if (failures == 0 && missing == 0) {
+        printf("\n PASS\n");
+        return 0;
+    }
+    if (failures > 0) {
+        printf("\n FAIL: p99 latency regressed\n");
+    }
+    if (missing > 0) {
+        printf("\n FAIL: %d configuration(s) have no baseline in %s\n", missing, pBaselinePath);
+    }
+    return 1;
+}
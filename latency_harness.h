@@ -0,0 +1,61 @@
+/*****************************************************************//**
+ * \file   latency_harness.h
+ * \brief  ͒x̉AeXgn[lX
+ *
+ * foCXm̎ɉGbW𒍓Aۂ
+ * GameController::Update()IsTriggerzԂŉ񂵂
+ * u  Q[߂Ċϑv̕z𑪂B
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+
+//==============================================================================
+// eXg
+//==============================================================================
+struct LatencyTestConfig {
+    int frameRate = 60;            // Q[̃t[[giHzj
+    int pollRate = 125;            // foCX̃|[O[giHzj
+    int pressCount = 2000;         // 鉟
+    float holdTime = 0.1f;         // ێ鎞ԁibj
+    float intervalMin = 0.05f;     // Ă玟ɉ܂ł̍ŒZԁibj
+    float intervalMax = 0.3f;      // Ă玟ɉ܂ł̍Œԁibj
+    unsigned int seed = 1;         // V[hilȂ猋ʂj
+};
+
+//==============================================================================
+// eXgʁix̓~bj
+//==============================================================================
+struct LatencyTestResult {
+    int injected = 0;              // 
+    int observed = 0;              // IsTriggerŊϑł
+    int missed = 0;                // ϑłȂ
+    double minMs = 0.0;
+    double meanMs = 0.0;
+    double p50Ms = 0.0;
+    double p95Ms = 0.0;
+    double p99Ms = 0.0;
+    double maxMs = 0.0;
+};
+
+//==============================================================================
+// x[XCit[[g~|[O[gƂp99j
+//==============================================================================
+struct LatencyBaselineEntry {
+    int frameRate = 0;
+    int pollRate = 0;
+    double p99Ms = 0.0;
+};
+
+// 1Ԃ̃eXgs
+// GameController̓̓\[XE\[X͎sւAIɖ߂
+bool RunLatencyTest(const LatencyTestConfig& config, LatencyTestResult* pResult);
+
+// x[XCt@C̓ǂݏi1sɁuframeRate pollRate p99Msvj
+int LoadLatencyBaseline(const char* pPath, LatencyBaselineEntry* pEntries, int maxEntries);
+bool SaveLatencyBaseline(const char* pPath, const LatencyBaselineEntry* pEntries, int count);
+
+// W̏\ŃeXgsAʂ\
+// x[XCp991AȂ0Ԃ
+// updateBaselinetrueȂrɌʂx[XCƂĕۑ
+int RunLatencyRegression(const char* pBaselinePath, bool updateBaseline);
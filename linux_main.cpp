@@ -0,0 +1,134 @@
+/*****************************************************************//**
+ * \file   linux_main.cpp
+ * \brief  Rg[[̓fobOpiLinuxŁj
+ *
+ * XInputER\[gmain.cppWindowspȂ̂ŁALinuxł
+ * Ȃǂݍ݃[viepollEio_uringEhidrawjƁA[ǂ
+ * L[{[h̓\[X͂炩瓮B
+ * rhCMakeLists.txtiWindowssample.slnjB
+ *********************************************************************/
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include "button_tracker.h"
+#include "gamepad_state.h"
+#include "hid_decode.h"
+#include "keyboard_source.h"
+#include "reader_benchmark.h"
+
+// L[{[h[h̍XVԊui60fpsj
+constexpr auto KEYBOARD_FRAME_INTERVAL = std::chrono::microseconds(16667);
+
+// Ctrl+CŎ~߂i[̐ݒ߂ĂI邽߁j
+static volatile sig_atomic_t s_quitRequested = 0;
+
+void OnInterrupt(int) {
+    s_quitRequested = 1;
+}
+
+// E{^̕\iButtonTracker̃rbgj
+struct ButtonName {
+    uint32_t button;
+    const char* pName;
+};
+
+const ButtonName BUTTON_NAMES[] = {
+    { PAD_BUTTON_A, "A" },
+    { PAD_BUTTON_B, "B" },
+    { PAD_BUTTON_X, "X" },
+    { PAD_BUTTON_Y, "Y" },
+    { PAD_BUTTON_LEFT_SHOULDER, "LB" },
+    { PAD_BUTTON_RIGHT_SHOULDER, "RB" },
+    { PAD_BUTTON_LEFT_TRIGGER, "LT" },
+    { PAD_BUTTON_RIGHT_TRIGGER, "RT" },
+    { PAD_BUTTON_LEFT_THUMB, "LS" },
+    { PAD_BUTTON_RIGHT_THUMB, "RS" },
+    { PAD_BUTTON_START, "START" },
+    { PAD_BUTTON_BACK, "BACK" },
+    { PAD_BUTTON_DPAD_UP, "U" },
+    { PAD_BUTTON_DPAD_DOWN, "D" },
+    { PAD_BUTTON_DPAD_LEFT, "L" },
+    { PAD_BUTTON_DPAD_RIGHT, "R" },
+};
+
+// L[{[hpbhƂēǂ݁AfR[hƉuԁEuԂ̔ʂĕ\
+// ̒l{^ςt[1soiESCCtrl+CŏIj
+// g: sample_linux --keyboardipCv痬ł悢j
+int RunKeyboardMode() {
+    KeyboardSource keyboard;
+    if (!keyboard.Open()) {
+        printf("cannot read standard input\n");
+        return 1;
+    }
+    signal(SIGINT, OnInterrupt);
+    printf("keyboard: WASD / TFGH sticks, arrows dpad, 1-4 face, Q/E shoulders, Z/X triggers, ESC quits\n");
+
+    GamepadCalibration calibration;
+    GamepadState state;
+    ButtonTracker tracker;
+    RawGamepad prevPad;
+    auto start = std::chrono::steady_clock::now();
+    while (!s_quitRequested) {
+        uint64_t timeUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count());
+        keyboard.Update(timeUs);
+
+        bool quit = false;
+        for (int key = keyboard.PopKey(); key >= 0; key = keyboard.PopKey()) {
+            if (key == KEYBOARD_KEY_ESCAPE) quit = true;
+        }
+        if (quit) {
+            break;
+        }
+
+        const RawGamepad& pad = keyboard.GetGamepad();
+        DecodeGamepad(pad, calibration, &state);
+        uint32_t buttons = pad.buttons |
+            (state.buttonL2 ? PAD_BUTTON_LEFT_TRIGGER : 0) | (state.buttonR2 ? PAD_BUTTON_RIGHT_TRIGGER : 0);
+        tracker.Update(buttons, timeUs);
+
+        uint32_t pressed = tracker.GetPressedMask();
+        uint32_t released = tracker.GetReleasedMask();
+        if (pressed != 0 || released != 0 || memcmp(&pad, &prevPad, sizeof(pad)) != 0) {
+            printf("%8.3fs  L(%+5.2f,%+5.2f) R(%+5.2f,%+5.2f) LT %4.2f RT %4.2f ",
+                timeUs / 1000000.0, state.leftStickX, state.leftStickY, state.rightStickX, state.rightStickY,
+                state.leftTrigger, state.rightTrigger);
+            for (const ButtonName& name : BUTTON_NAMES) {
+                if (pressed & name.button) printf(" %s+", name.pName);
+            }
+            for (const ButtonName& name : BUTTON_NAMES) {
+                if (released & name.button) printf(" %s-", name.pName);
+            }
+            printf("\n");
+            fflush(stdout);
+            prevPad = pad;
+        }
+
+        std::this_thread::sleep_for(KEYBOARD_FRAME_INTERVAL);
+    }
+    return 0;
+}
+
+void PrintUsage() {
+    printf("usage: sample_linux <mode>\n");
+    printf("  --bench-readers                              epoll / io_uring reader benchmark\n");
+    printf("  --hid-decode <descriptor.bin> <reports.bin>  decode captured HID reports\n");
+    printf("  --keyboard                                   keyboard as a gamepad (decode + edges)\n");
+}
+
+int main(int argc, char* argv[]) {
+    if (argc >= 2 && strcmp(argv[1], "--bench-readers") == 0) {
+        return RunInputReaderBenchmark();
+    }
+    if (argc >= 2 && strcmp(argv[1], "--hid-decode") == 0) {
+        return RunHidDecodeMode(argc - 2, argv + 2);
+    }
+    if (argc >= 2 && strcmp(argv[1], "--keyboard") == 0) {
+        return RunKeyboardMode();
+    }
+
+    PrintUsage();
+    return 1;
+}
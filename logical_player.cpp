@@ -0,0 +1,149 @@
+/*****************************************************************//**
+ * \file   logical_player.cpp
+ * \brief  ̓̓foCX1l̃vC[ɂ܂Ƃ߂
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "logical_player.h"
+#include <cstring>
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // ȂĂȂ\[XǂݒԊuiGetState()̌ĂяopxɂȂj
+    constexpr uint64_t RETRY_INTERVAL_US = 1000000;
+
+    // XeBbN̓|Ăʁi2A3276722{ł32rbgɎ܂j
+    uint32_t StickMagnitudeSq(SHORT x, SHORT y) {
+        int32_t ix = x;
+        int32_t iy = y;
+        return static_cast<uint32_t>(ix * ix) + static_cast<uint32_t>(iy * iy);
+    }
+
+    //==========================================================================
+    // 1̎O[viXeBbNEgK[j̑I
+    //==========================================================================
+    // 1āAKɏ]č̗p邩߂
+    struct AxisPicker {
+        AxisMergeRule rule;
+        uint32_t threshold;     // D揇ʂ̂Ƃ́ugĂv
+        uint32_t bestScore = 0;
+        bool hasCandidate = false;
+        bool isActiveChosen = false;
+
+        bool Offer(uint32_t score) {
+            if (!hasCandidate) {
+                hasCandidate = true;
+                bestScore = score;
+                isActiveChosen = (score > threshold);
+                return true;
+            }
+            if (rule == AXIS_MERGE_MAX_MAGNITUDE) {
+                if (score <= bestScore) return false;
+            } else {
+                // ɎgĂ\[X΂̂܂܁AŗD悪xł΍ŏɎĝ
+                if (isActiveChosen || score <= threshold) return false;
+                isActiveChosen = true;
+            }
+            bestScore = score;
+            return true;
+        }
+    };
+}
+
+LogicalPlayer* LogicalPlayer::s_pPlayers[MAX_PLAYERS] = {};
+
+//==============================================================================
+// \[X̓o^
+//==============================================================================
+int LogicalPlayer::AddSource(StateSourceFunc pFunc, DWORD userIndex) {
+    if (m_sourceCount >= MAX_SOURCES) {
+        return -1;
+    }
+    Source& source = m_sources[m_sourceCount];
+    source.pFunc = (pFunc != nullptr) ? pFunc : XInputBackend::GetState;
+    source.userIndex = userIndex;
+    source.nextRetryTime = 0;
+    return m_sourceCount++;
+}
+
+void LogicalPlayer::ClearSources() {
+    m_sourceCount = 0;
+    m_connectedMask = 0;
+}
+
+//==============================================================================
+// 擾iS\[X1񂸂ǂ݂Ȃ܂Ƃ߂j
+//==============================================================================
+DWORD LogicalPlayer::GetState(XINPUT_STATE* pState) {
+    uint32_t stickThreshold = StickMagnitudeSq(m_rules.stickActiveThreshold, 0);
+    AxisPicker leftStick = { m_rules.stickRule, stickThreshold };
+    AxisPicker rightStick = { m_rules.stickRule, stickThreshold };
+    AxisPicker leftTrigger = { m_rules.triggerRule, m_rules.triggerActiveThreshold };
+    AxisPicker rightTrigger = { m_rules.triggerRule, m_rules.triggerActiveThreshold };
+
+    XINPUT_GAMEPAD merged;
+    ZeroMemory(&merged, sizeof(XINPUT_GAMEPAD));
+    m_connectedMask = 0;
+    uint64_t now = GameController::GetTimeUs();
+
+    for (int i = 0; i < m_sourceCount; i++) {
+        Source& source = m_sources[i];
+        if (now < source.nextRetryTime) {
+            continue;
+        }
+
+        XINPUT_STATE state;
+        if (source.pFunc(source.userIndex, &state) != ERROR_SUCCESS) {
+            source.nextRetryTime = now + RETRY_INTERVAL_US;
+            continue;
+        }
+        m_connectedMask |= 1u << i;
+
+        const XINPUT_GAMEPAD& pad = state.Gamepad;
+        merged.wButtons |= pad.wButtons;
+        if (leftStick.Offer(StickMagnitudeSq(pad.sThumbLX, pad.sThumbLY))) {
+            merged.sThumbLX = pad.sThumbLX;
+            merged.sThumbLY = pad.sThumbLY;
+        }
+        if (rightStick.Offer(StickMagnitudeSq(pad.sThumbRX, pad.sThumbRY))) {
+            merged.sThumbRX = pad.sThumbRX;
+            merged.sThumbRY = pad.sThumbRY;
+        }
+        if (leftTrigger.Offer(pad.bLeftTrigger)) {
+            merged.bLeftTrigger = pad.bLeftTrigger;
+        }
+        if (rightTrigger.Offer(pad.bRightTrigger)) {
+            merged.bRightTrigger = pad.bRightTrigger;
+        }
+    }
+
+    if (m_connectedMask == 0) {
+        return ERROR_DEVICE_NOT_CONNECTED;
+    }
+
+    if (memcmp(&merged, &m_lastGamepad, sizeof(XINPUT_GAMEPAD)) != 0) {
+        m_lastGamepad = merged;
+        m_packetNumber++;
+    }
+    pState->dwPacketNumber = m_packetNumber;
+    pState->Gamepad = merged;
+    return ERROR_SUCCESS;
+}
+
+//==============================================================================
+// GameController::SetStateSource()p
+//==============================================================================
+DWORD WINAPI LogicalPlayer::GetStateFor(DWORD userIndex, XINPUT_STATE* pState) {
+    if (userIndex >= MAX_PLAYERS || s_pPlayers[userIndex] == nullptr) {
+        return ERROR_DEVICE_NOT_CONNECTED;
+    }
+    return s_pPlayers[userIndex]->GetState(pState);
+}
+
+void LogicalPlayer::Register(DWORD userIndex, LogicalPlayer* pPlayer) {
+    if (userIndex < MAX_PLAYERS) {
+        s_pPlayers[userIndex] = pPlayer;
+    }
+}
@@ -0,0 +1,97 @@
+/*****************************************************************//**
+ * \file   logical_player.h
+ * \brief  ̓̓foCX1l̃vC[ɂ܂Ƃ߂
+ *
+ * pbhƃL[{[hAANZVreB̂߂2̃pbhȂǁA
+ * ̃\[X1XINPUT_STATEɂ܂Ƃ߂B܂Ƃ߂̂̓fR[hO
+ * ̒lȂ̂ŁAfR[hEfbh][EuԂ̔1񂾂ōςށB
+ *
+ *   {^       : ׂẴ\[XOR
+ *   XeBbN   : |Ăʂő̂́A܂͗D揇ʁio^jōŏɓ|Ă
+ *   gK[     : őlA܂͗D揇ʂōŏɈĂ
+ *
+ * GetStateFor()GameController::SetStateSource()ɓn΁A
+ * Q[͂̎擾֐̂܂܂ŎgB
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include <windows.h>
+#include <Xinput.h>
+#include <cstdint>
+#include "game_controller.h"
+
+//==============================================================================
+// ܂Ƃߕ
+//==============================================================================
+enum AxisMergeRule {
+    AXIS_MERGE_MAX_MAGNITUDE,   // |ĂʁiĂʁjő̃\[X
+    AXIS_MERGE_PRIORITY,        // o^ōŏ臒l𒴂\[X
+};
+
+struct LogicalPlayerRules {
+    AxisMergeRule stickRule = AXIS_MERGE_MAX_MAGNITUDE;
+    AxisMergeRule triggerRule = AXIS_MERGE_MAX_MAGNITUDE;
+
+    // D揇ʂőIԂƂɁugĂvƂ݂Ȃʁi̒lAǂȂ΍ŗD̃\[Xj
+    int16_t stickActiveThreshold = PAD_STICK_DEADZONE_LEFT;
+    uint8_t triggerActiveThreshold = PAD_TRIGGER_THRESHOLD;
+};
+
+//==============================================================================
+// _vC[NX
+//==============================================================================
+class LogicalPlayer {
+public:
+    static constexpr int MAX_SOURCES = 8;
+    // SetStateSource()IׂvC[iuserIndexŎwj
+    static constexpr int MAX_PLAYERS = XUSER_MAX_COUNT;
+
+    //==========================================================================
+    // \[X̓o^io^D揇ʁj
+    //==========================================================================
+    // pFuncnullptrȂXInputGetStateA߂l̓\[XԍitȂ-1j
+    int AddSource(StateSourceFunc pFunc, DWORD userIndex);
+    void ClearSources();
+    int GetSourceCount() const { return m_sourceCount; }
+
+    void SetRules(const LogicalPlayerRules& rules) { m_rules = rules; }
+    const LogicalPlayerRules& GetRules() const { return m_rules; }
+
+    //==========================================================================
+    // 擾
+    //==========================================================================
+    // S\[X1񂸂ǂł܂Ƃ߂iǂȂĂȂERROR_DEVICE_NOT_CONNECTEDj
+    DWORD GetState(XINPUT_STATE* pState);
+
+    // ߂GetState()łȂĂ\[XirbgƁj
+    uint32_t GetConnectedMask() const { return m_connectedMask; }
+
+    //==========================================================================
+    // GameController::SetStateSource()p
+    //==========================================================================
+    // userIndexԂɓo^ꂽvC[ǂށio^ȂERROR_DEVICE_NOT_CONNECTEDj
+    static DWORD WINAPI GetStateFor(DWORD userIndex, XINPUT_STATE* pState);
+    // nullptrœo^O
+    static void Register(DWORD userIndex, LogicalPlayer* pPlayer);
+
+private:
+    struct Source {
+        StateSourceFunc pFunc;
+        DWORD userIndex;
+        // ȂĂȂ\[X͂̎܂œǂ܂ȂiXInput̋󂫃Xbg͓ǂނŏdj
+        // GameController::GetTimeUs()
+        uint64_t nextRetryTime;
+    };
+
+    Source m_sources[MAX_SOURCES] = {};
+    int m_sourceCount = 0;
+    LogicalPlayerRules m_rules;
+    uint32_t m_connectedMask = 0;
+
+    // ܂Ƃ߂ʂςi߂iXINPUT_STATEdwPacketNumberƂĕԂj
+    DWORD m_packetNumber = 0;
+    XINPUT_GAMEPAD m_lastGamepad = {};
+
+    static LogicalPlayer* s_pPlayers[MAX_PLAYERS];
+};
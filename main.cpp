@@ -2,11 +2,34 @@
  * \file   main.cpp
  * \brief  Rg[[̓fobOpiXInputŁj
  *********************************************************************/
+#include <chrono>
+#include <cmath>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <string>
+#include <vector>
 #include <conio.h>
 #include <windows.h>
 #include "game_controller.h"
+#include "chord_detector.h"
+#include "console_frame.h"
+#include "contention_benchmark.h"
+#include "controller_benchmark.h"
+#include "deadzone_tuner.h"
+#include "hid_decode.h"
+#include "input_analyzer.h"
+#include "input_history.h"
+#include "keyboard_source.h"
+#include "latency_harness.h"
+#include "logical_player.h"
+#include "pad_overview.h"
+#include "reader_benchmark.h"
+#include "stick_plot.h"
+#include "state_benchmark.h"
+
+// timeBeginPeriodiOՃ[h1ms݂œǂނ߁j
+#pragma comment(lib, "winmm.lib")
 
  // J[\ɖ߂
 void ClearScreen() {
@@ -14,9 +37,12 @@ void ClearScreen() {
     SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), coord);
 }
 
+// j^[̏o͐inullptrŕWóAx`}[Nł͎̂Đɂj
+static FILE* s_pMonitorOut = nullptr;
+
 // Œ蕝1sói79+sj
 void PrintLine(const char* pStr) {
-    printf("%-79s\n", pStr);
+    fprintf((s_pMonitorOut != nullptr) ? s_pMonitorOut : stdout, "%-79s\n", pStr);
 }
 
 // XeBbNpo[񐶐
@@ -50,8 +76,912 @@ void AppendEvent(char* pEvent, size_t eventSize, const char* pText) {
     strcat_s(pEvent, eventSize, pText);
 }
 
-int main() {
+// {^Ƃ̃Cxg\
+struct ButtonEventLabel {
+    bool GamepadState::* pMember;
+    const char* pPress;
+    const char* pRelease;
+};
+
+// ʃ{^iEEEEAO̓{^zuj
+bool GamepadState::* const FACE_BUTTON_MEMBERS[4] = {
+    &GamepadState::buttonDown, &GamepadState::buttonRight, &GamepadState::buttonLeft, &GamepadState::buttonUp,
+};
+
+const ButtonEventLabel BUTTON_EVENT_LABELS[] = {
+    { &GamepadState::buttonConfirm, " OK+",   " OK-" },
+    { &GamepadState::buttonCancel, " CANCEL+", " CANCEL-" },
+    { &GamepadState::buttonL1,     " LB+",    " LB-" },
+    { &GamepadState::buttonR1,     " RB+",    " RB-" },
+    { &GamepadState::buttonL2,     " LT+",    " LT-" },
+    { &GamepadState::buttonR2,     " RT+",    " RT-" },
+    { &GamepadState::buttonL3,     " LS+",    " LS-" },
+    { &GamepadState::buttonR3,     " RS+",    " RS-" },
+    { &GamepadState::buttonStart,  " START+", " START-" },
+    { &GamepadState::buttonSelect, " BACK+",  " BACK-" },
+    { &GamepadState::dpadUp,       " U+",     " U-" },
+    { &GamepadState::dpadDown,     " D+",     " D-" },
+    { &GamepadState::dpadLeft,     " L+",     " L-" },
+    { &GamepadState::dpadRight,    " R+",     " R-" },
+};
+
+// Ot[Ƃ̔rŃCxgiuԁuԂ̏j
+void BuildEventText(char* pEvent, size_t eventSize, const GamepadState& state, const GamepadState& prev) {
+    const ButtonLayout& layout = GameController::GetButtonLayout();
+    char text[32];
+
+    strcpy_s(pEvent, eventSize, " Event:");
+    for (int i = 0; i < 4; i++) {
+        bool GamepadState::* pMember = FACE_BUTTON_MEMBERS[i];
+        if (state.*pMember && !(prev.*pMember)) {
+            sprintf_s(text, sizeof(text), " %s+", layout.faceNames[i]);
+            AppendEvent(pEvent, eventSize, text);
+        }
+    }
+    for (const ButtonEventLabel& label : BUTTON_EVENT_LABELS) {
+        if (state.*label.pMember && !(prev.*label.pMember)) AppendEvent(pEvent, eventSize, label.pPress);
+    }
+    for (int i = 0; i < 4; i++) {
+        bool GamepadState::* pMember = FACE_BUTTON_MEMBERS[i];
+        if (!(state.*pMember) && prev.*pMember) {
+            sprintf_s(text, sizeof(text), " %s-", layout.faceNames[i]);
+            AppendEvent(pEvent, eventSize, text);
+        }
+    }
+    for (const ButtonEventLabel& label : BUTTON_EVENT_LABELS) {
+        if (!(state.*label.pMember) && prev.*label.pMember) AppendEvent(pEvent, eventSize, label.pRelease);
+    }
+}
+
+// ʃ{^̕\iĂ[]ň͂ށj
+void FormatFaceButton(char* pBuf, size_t bufSize, bool pressed, const char* pLabel) {
+    sprintf_s(pBuf, bufSize, pressed ? "[%s]" : " %s ", pLabel);
+}
+
+// ̃Tṽ݂{^zuELu[VŃfR[h
+void DecodeHistorySample(const RawGamepad& raw, GamepadState* pState) {
+    RawGamepad remapped = raw;
+    remapped.buttons = GameController::GetButtonLayout().remap.Apply(raw.buttons);
+    DecodeGamepad(remapped, GameController::GetCalibration(), pState);
+}
+
+// gL[i_getch0224Ԃ2oCgڂ256𑫂lj
+constexpr int KEY_UP = 256 + 72;
+constexpr int KEY_LEFT = 256 + 75;
+constexpr int KEY_RIGHT = 256 + 77;
+constexpr int KEY_DOWN = 256 + 80;
+constexpr int KEY_HOME = 256 + 71;
+constexpr int KEY_END = 256 + 79;
+
+// L^t@Ciinput_YYYYMMDD_HHMMSS.xirj
+void MakeRecordFileName(char* pBuf, size_t bufSize) {
+    SYSTEMTIME time;
+    GetLocalTime(&time);
+    sprintf_s(pBuf, bufSize, "input_%04d%02d%02d_%02d%02d%02d.xir",
+        time.wYear, time.wMonth, time.wDay, time.wHour, time.wMinute, time.wSecond);
+}
+
+// ̕ێʁik̃oCgj
+constexpr size_t HISTORY_MEMORY_BYTES = 1024 * 1024;
+
+// 1bi}CNbj
+constexpr uint64_t ONE_SECOND_US = 1000000;
+
+// Lu[ViXeBbN𗣂đ҂ԁAʂ\Ăԁj
+const char* const CALIBRATION_PATH = "calibration.txt";
+constexpr uint64_t CALIBRATION_CAPTURE_US = 2 * ONE_SECOND_US;
+constexpr uint64_t CALIBRATION_MESSAGE_US = 5 * ONE_SECOND_US;
+
+// ̕\itԂ̓t[A\Ăԁj
+struct ChordLabel {
+    uint32_t buttons;
+    int frames;
+    const char* pName;
+};
+
+const ChordLabel DEMO_CHORDS[] = {
+    { PAD_BUTTON_LEFT_SHOULDER | PAD_BUTTON_RIGHT_SHOULDER, 3, "LB+RB" },
+    { PAD_BUTTON_LEFT_TRIGGER | PAD_BUTTON_RIGHT_TRIGGER,   3, "LT+RT" },
+    { PAD_BUTTON_CONFIRM | PAD_BUTTON_CANCEL,               3, "OK+CANCEL" },
+    { PAD_BUTTON_LEFT_THUMB | PAD_BUTTON_RIGHT_THUMB,       6, "L3+R3" },
+    { PAD_BUTTON_START | PAD_BUTTON_BACK,                   6, "START+BACK" },
+};
+constexpr uint64_t CHORD_MESSAGE_US = 2 * ONE_SECOND_US;
+
+// Lu[V1s\
+void FormatCalibration(char* pBuf, size_t bufSize, const GamepadCalibration& calibration) {
+    sprintf_s(pBuf, bufSize, "L(%d,%d) dz %d  R(%d,%d) dz %d  LT %d  RT %d",
+        calibration.leftStick.centerX, calibration.leftStick.centerY, calibration.leftStick.deadzone,
+        calibration.rightStick.centerX, calibration.rightStick.centerY, calibration.rightStick.deadzone,
+        calibration.leftTriggerThreshold, calibration.rightTriggerThreshold);
+}
+
+// ̕\ʒustep炵
+uint64_t StepHistory(InputHistory& history, uint64_t viewTime, int step) {
+    int index = history.FindIndexByTime(viewTime) + step;
+    if (index < 0) index = 0;
+    if (index >= history.GetCount()) index = history.GetCount() - 1;
+
+    InputSample sample;
+    if (!history.GetSample(index, &sample)) {
+        return viewTime;
+    }
+    return sample.timeUs;
+}
+
+// ̍ŌÁEŐV̎
+uint64_t GetHistoryTime(InputHistory& history, bool newest) {
+    InputSample sample;
+    if (!history.GetSample(newest ? history.GetCount() - 1 : 0, &sample)) {
+        return 0;
+    }
+    return sample.timeUs;
+}
+
+// zbgL[1ǂށiȂ-1j
+// L[{[h̓\[XgĂƂ̓R\[͂炪ǂނ̂ŁA󂯎
+int ReadHotkey(KeyboardSource* pKeyboard) {
+    if (pKeyboard != nullptr) {
+        return pKeyboard->PopKey();
+    }
+    if (!_kbhit()) {
+        return -1;
+    }
+    int key = _getch();
+    if (key == 0 || key == 224) {
+        key = 256 + _getch();
+    }
+    return key;
+}
+
+// ڑɖŒZ
+constexpr DWORD IDLE_MIN_WAIT_MS = 50;
+
+// ڑ̑ҋ@iL[́EfoCXǉE̍ĒT̂ǂꂩ܂Ŗj
+void WaitWhileDisconnected(HANDLE hInput) {
+    // _kbhit()̓L[`Ȃ̂ŁAL[𗣂EtH[JXE}EXȂǂ
+    // CxgcĂƓ̓nhVOî܂܂ɂȂA҂ɖ߂Ă܂
+    // ǂރL[Ȃ΁AcĂCxĝ͎ĂĂ҂
+    if (_kbhit()) {
+        return;
+    }
+    FlushConsoleInputBuffer(hInput);
+
+    // ̓\[XւĂƂi--mergeȂǁjĒT̒O0Ԃ̂ŁA
+    // Œł͖ĉʂ̕`ƃ\[X̓ǂݍ݂}
+    DWORD waitMs = GameController::GetIdleWaitMs();
+    if (waitMs < IDLE_MIN_WAIT_MS) {
+        waitMs = IDLE_MIN_WAIT_MS;
+    }
+
+    HANDLE handles[2] = { hInput, GameController::GetArrivalEvent() };
+    DWORD count = (handles[1] != nullptr) ? 2 : 1;
+    WaitForMultipleObjects(count, handles, FALSE, waitMs);
+}
+
+// j^[ʂ`iڑEꎞ~̋ʕj
+void DrawMonitor(const GamepadState& state, const GamepadState& prev, const char* pStatus, const char* pHistoryInfo) {
+    char line[128];
+    char barLX[16], barLY[16], barRX[16], barRY[16];
+    char barLT[16], barRT[16];
+
+    GetStickBar(barLX, sizeof(barLX), state.leftStickX);
+    GetStickBar(barLY, sizeof(barLY), state.leftStickY);
+    GetStickBar(barRX, sizeof(barRX), state.rightStickX);
+    GetStickBar(barRY, sizeof(barRY), state.rightStickY);
+    GetTriggerBar(barLT, sizeof(barLT), state.leftTrigger);
+    GetTriggerBar(barRT, sizeof(barRT), state.rightTrigger);
+
+    // {^\p
+    const char* pDpadUp = state.dpadUp ? "[U]" : " U ";
+    const char* pDpadDown = state.dpadDown ? "[D]" : " D ";
+    const char* pDpadLeft = state.dpadLeft ? "[L]" : " L ";
+    const char* pDpadRight = state.dpadRight ? "[R]" : " R ";
+
+    const ButtonLayout& layout = GameController::GetButtonLayout();
+    char pMainDown[16], pMainRight[16], pMainLeft[16], pMainUp[16];
+    FormatFaceButton(pMainDown, sizeof(pMainDown), state.buttonDown, layout.faceLabels[0]);
+    FormatFaceButton(pMainRight, sizeof(pMainRight), state.buttonRight, layout.faceLabels[1]);
+    FormatFaceButton(pMainLeft, sizeof(pMainLeft), state.buttonLeft, layout.faceLabels[2]);
+    FormatFaceButton(pMainUp, sizeof(pMainUp), state.buttonUp, layout.faceLabels[3]);
+
+    const char* pBtnL1 = state.buttonL1 ? "[LB]" : " LB ";
+    const char* pBtnR1 = state.buttonR1 ? "[RB]" : " RB ";
+    const char* pBtnL2 = state.buttonL2 ? "[LT]" : " LT ";
+    const char* pBtnR2 = state.buttonR2 ? "[RT]" : " RT ";
+    const char* pBtnL3 = state.buttonL3 ? "[LS]" : " LS ";
+    const char* pBtnR3 = state.buttonR3 ? "[RS]" : " RS ";
+
+    const char* pBtnSelect = state.buttonSelect ? "[BACK]" : " BACK  ";
+    const char* pBtnStart = state.buttonStart ? "[START]" : " START ";
+
+    const char* pVibration = GameController::IsVibrating() ? "[VIBRATING]" : "           ";
+
+    PrintLine("===============================================================================");
+    PrintLine("                    XINPUT CONTROLLER DEBUG MONITOR                            ");
+    PrintLine("===============================================================================");
+
+    sprintf_s(line, sizeof(line), " Status: %-52s%s", pStatus, pVibration);
+    PrintLine(line);
+
+    PrintLine("-------------------------------------------------------------------------------");
+
+    sprintf_s(line, sizeof(line), " L Stick | X:%6.2f %s   Y:%6.2f %s",
+        state.leftStickX, barLX, state.leftStickY, barLY);
+    PrintLine(line);
+
+    sprintf_s(line, sizeof(line), " R Stick | X:%6.2f %s   Y:%6.2f %s",
+        state.rightStickX, barRX, state.rightStickY, barRY);
+    PrintLine(line);
+
+    sprintf_s(line, sizeof(line), " Trigger | LT:%5.2f %s    RT:%5.2f %s",
+        state.leftTrigger, barLT, state.rightTrigger, barRT);
+    PrintLine(line);
+
+    PrintLine("-------------------------------------------------------------------------------");
+
+    sprintf_s(line, sizeof(line), "  D-PAD        %s                %-17s%s", pDpadUp, layout.pName, pMainUp);
+    PrintLine(line);
+
+    sprintf_s(line, sizeof(line), "            %s   %s                           %s  %s",
+        pDpadLeft, pDpadRight, pMainLeft, pMainRight);
+    PrintLine(line);
+
+    sprintf_s(line, sizeof(line), "               %s                                 %s", pDpadDown, pMainDown);
+    PrintLine(line);
+
+    PrintLine("-------------------------------------------------------------------------------");
+
+    sprintf_s(line, sizeof(line), " Shoulder: %s %s                                     %s %s",
+        pBtnL1, pBtnL2, pBtnR2, pBtnR1);
+    PrintLine(line);
+
+    sprintf_s(line, sizeof(line), " Stick   : %s                                             %s",
+        pBtnL3, pBtnR3);
+    PrintLine(line);
+
+    sprintf_s(line, sizeof(line), " System  : %s                                      %s",
+        pBtnSelect, pBtnStart);
+    PrintLine(line);
+
+    PrintLine("-------------------------------------------------------------------------------");
+
+    char event[128];
+    BuildEventText(event, sizeof(event), state, prev);
+    PrintLine(event);
+
+    PrintLine("===============================================================================");
+    PrintLine(" ESC: Exit  |  V/B: Vibration Strong/Weak  |  C: Calibrate  |  L: Layout");
+    PrintLine(" P: Pause/Live  |  Left/Right: Step  |  Up/Down: +1s/-1s  |  Home/End  |  R: Rec");
+    PrintLine(pHistoryInfo);
+}
+
+// xAeXg[h
+// g: sample.exe --latency [baseline.txt] [--update-baseline]
+int RunLatencyMode(int argc, char* argv[]) {
+    const char* pBaselinePath = "latency_baseline.txt";
+    bool updateBaseline = false;
+    for (int i = 0; i < argc; i++) {
+        if (strcmp(argv[i], "--update-baseline") == 0) {
+            updateBaseline = true;
+        } else {
+            pBaselinePath = argv[i];
+        }
+    }
+    return RunLatencyRegression(pBaselinePath, updateBaseline);
+}
+
+// fBNg񋓂ŌL^t@Cǉ
+void AddRecordPath(const char* pPath, void* pContext) {
+    static_cast<std::vector<std::string>*>(pContext)->push_back(pPath);
+}
+
+// L^t@Cfbh][𐄒肷郂[h
+// g: sample.exe --tune <file.xir | directory> ... [-o calibration.txt]
+int RunTuneMode(int argc, char* argv[]) {
+    const char* pOutputPath = nullptr;
+    std::vector<std::string> paths;
+    for (int i = 0; i < argc; i++) {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            pOutputPath = argv[++i];
+        } else if (EnumerateRecordFiles(argv[i], AddRecordPath, &paths) == 0) {
+            paths.push_back(argv[i]);
+        }
+    }
+    if (paths.empty()) {
+        printf("usage: --tune <file.xir | directory> ... [-o calibration.txt]\n");
+        return 1;
+    }
+
+    // L^̒Î~ĂԂg
+    DeadzoneTuner tuner;
+    for (const std::string& path : paths) {
+        InputRecordReader reader;
+        if (!reader.Open(path.c_str())) {
+            printf("failed to open %s\n", path.c_str());
+            continue;
+        }
+        InputSample sample;
+        while (reader.Next(&sample)) {
+            tuner.AddSample(sample);
+        }
+    }
+
+    GamepadCalibration calibration;
+    DeadzoneTuneReport report;
+    bool ok = tuner.Compute(&calibration, &report);
+    printf("rest samples %d  (rejected windows %d)\n", report.acceptedSamples, report.rejectedWindows);
+    if (!ok) {
+        printf("not enough resting samples (need %d)\n", DeadzoneTuner::MIN_REST_SAMPLES);
+        return 1;
+    }
+
+    const StickNoiseReport* pNoise[2] = { &report.leftStick, &report.rightStick };
+    const char* pNames[2] = { "left ", "right" };
+    for (int i = 0; i < 2; i++) {
+        printf("%s stick  mean (%.1f, %.1f)  sigma (%.1f, %.1f)  envelope %d\n", pNames[i],
+            pNoise[i]->meanX, pNoise[i]->meanY, pNoise[i]->sigmaX, pNoise[i]->sigmaY, pNoise[i]->envelope);
+    }
+    printf("trigger rest max  L %d  R %d\n", report.leftTriggerMax, report.rightTriggerMax);
+
+    char text[128];
+    FormatCalibration(text, sizeof(text), calibration);
+    printf("calibration: %s\n", text);
+
+    if (pOutputPath != nullptr && !SaveCalibrationProfile(pOutputPath, calibration)) {
+        printf("failed to write %s\n", pOutputPath);
+        return 1;
+    }
+    return 0;
+}
+
+// L^t@C̏Wv[h
+// g: sample.exe --analyze [-j threads] <file.xir | directory> ...
+int RunAnalyzeMode(int argc, char* argv[]) {
+    int threadCount = 0;
+    std::vector<std::string> paths;
+    for (int i = 0; i < argc; i++) {
+        if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            threadCount = atoi(argv[++i]);
+        } else if (EnumerateRecordFiles(argv[i], AddRecordPath, &paths) == 0) {
+            paths.push_back(argv[i]);
+        }
+    }
+    if (paths.empty()) {
+        printf("usage: --analyze [-j threads] <file.xir | directory> ...\n");
+        return 1;
+    }
+
+    std::vector<const char*> pathList;
+    for (const std::string& path : paths) {
+        pathList.push_back(path.c_str());
+    }
+
+    InputCorpusStats stats;
+    auto begin = std::chrono::steady_clock::now();
+    AnalyzeCorpus(pathList.data(), pathList.size(), threadCount, &stats);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    PrintCorpusStats(stats, stdout);
+    printf("\nanalyzed in %.2f s (%.1f MB/s, %.1f M samples/s)\n", seconds,
+        (seconds > 0.0) ? stats.byteCount / (1024.0 * 1024.0) / seconds : 0.0,
+        (seconds > 0.0) ? stats.sampleCount / 1000000.0 / seconds : 0.0);
+    return (stats.failedFileCount != 0) ? 1 : 0;
+}
+
+// ꗗ̃{^\iĂȂΓ̓_j
+void AppendOverviewButton(char* pBuf, size_t bufSize, bool pressed, const char* pLabel) {
+    char text[16];
+    size_t length = strlen(pLabel);
+    for (size_t i = 0; i < length; i++) {
+        text[i] = pressed ? pLabel[i] : '.';
+    }
+    text[length] = ' ';
+    text[length + 1] = '\0';
+    strcat_s(pBuf, bufSize, text);
+}
+
+// ꗗ1Xbgi39x11j`
+void DrawOverviewPane(ConsoleFrame* pFrame, int x, int y, int slot, const PadSlotView& view) {
+    constexpr int WIDTH = 39;
+    const GamepadState& state = view.state;
+    pFrame->Fill(x, y + 1, WIDTH, 10);
+
+    if (!view.connected) {
+        pFrame->Printf(x, y + 1, WIDTH, " P%d  Not connected", slot + 1);
+    } else {
+        pFrame->Printf(x, y + 1, WIDTH, " P%d  Connected    Battery: %s", slot + 1,
+            view.battery.hasBatteryInfo ? view.battery.levelText : "-");
+
+        char barX[16], barY[16];
+        GetStickBar(barX, sizeof(barX), state.leftStickX);
+        GetStickBar(barY, sizeof(barY), state.leftStickY);
+        pFrame->Printf(x, y + 2, WIDTH, " L  X%s Y%s", barX, barY);
+        GetStickBar(barX, sizeof(barX), state.rightStickX);
+        GetStickBar(barY, sizeof(barY), state.rightStickY);
+        pFrame->Printf(x, y + 3, WIDTH, " R  X%s Y%s", barX, barY);
+
+        char barLT[16], barRT[16];
+        GetTriggerBar(barLT, sizeof(barLT), state.leftTrigger);
+        GetTriggerBar(barRT, sizeof(barRT), state.rightTrigger);
+        pFrame->Printf(x, y + 4, WIDTH, " LT%s     RT%s", barLT, barRT);
+
+        char buttons[64] = " ";
+        AppendOverviewButton(buttons, sizeof(buttons), state.dpadUp, "U");
+        AppendOverviewButton(buttons, sizeof(buttons), state.dpadDown, "D");
+        AppendOverviewButton(buttons, sizeof(buttons), state.dpadLeft, "L");
+        AppendOverviewButton(buttons, sizeof(buttons), state.dpadRight, "R");
+        strcat_s(buttons, sizeof(buttons), "  ");
+        AppendOverviewButton(buttons, sizeof(buttons), state.buttonDown, "A");
+        AppendOverviewButton(buttons, sizeof(buttons), state.buttonRight, "B");
+        AppendOverviewButton(buttons, sizeof(buttons), state.buttonLeft, "X");
+        AppendOverviewButton(buttons, sizeof(buttons), state.buttonUp, "Y");
+        strcat_s(buttons, sizeof(buttons), "  ");
+        AppendOverviewButton(buttons, sizeof(buttons), state.buttonSelect, "BACK");
+        AppendOverviewButton(buttons, sizeof(buttons), state.buttonStart, "START");
+        pFrame->Print(x, y + 6, buttons, WIDTH);
+
+        buttons[1] = '\0';
+        AppendOverviewButton(buttons, sizeof(buttons), state.buttonL1, "LB");
+        AppendOverviewButton(buttons, sizeof(buttons), state.buttonR1, "RB");
+        AppendOverviewButton(buttons, sizeof(buttons), state.buttonL2, "LT");
+        AppendOverviewButton(buttons, sizeof(buttons), state.buttonR2, "RT");
+        AppendOverviewButton(buttons, sizeof(buttons), state.buttonL3, "LS");
+        AppendOverviewButton(buttons, sizeof(buttons), state.buttonR3, "RS");
+        pFrame->Print(x, y + 7, buttons, WIDTH);
+    }
+
+    const PadSlotStats& stats = view.stats;
+    pFrame->Printf(x, y + 9, WIDTH, " Poll%4.0f/s  Input%4.0f/s  Read%6.1fus",
+        stats.pollsPerSecond, stats.packetsPerSecond, stats.readCostUs);
+    if (view.connected) {
+        pFrame->Printf(x, y + 10, WIDTH, " Packet %lu", static_cast<unsigned long>(view.packetNumber));
+    }
+}
+
+// 4l̈ꗗ[hiQA4lvCpj
+// \ςXbggݗĒAʂ͕ςo
+int RunOverviewMode() {
+    HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
+    CONSOLE_CURSOR_INFO cursorInfo;
+    GetConsoleCursorInfo(hConsole, &cursorInfo);
+    cursorInfo.bVisible = FALSE;
+    SetConsoleCursorInfo(hConsole, &cursorInfo);
+
+    // gi2x2AE̊Ԃɏcj
+    ConsoleFrame frame;
+    frame.Print(0, 0, "===============================================================================");
+    frame.Print(0, 1, "                         XINPUT 4-PLAYER OVERVIEW");
+    for (int row = 0; row < 2; row++) {
+        int y = 2 + row * 11;
+        frame.Print(0, y, "-------------------------------------------------------------------------------");
+        for (int i = 1; i < 11; i++) {
+            frame.Print(39, y + i, "|");
+        }
+    }
+    frame.Print(0, 24, " ESC: Exit");
+
+    PadOverview overview;
+    uint32_t drawnRevision[PadOverview::MAX_SLOTS] = {};
+    bool hasDrawn[PadOverview::MAX_SLOTS] = {};
+
+    bool isRunning = true;
+    while (isRunning) {
+        while (_kbhit()) {
+            if (_getch() == 27) {
+                isRunning = false;
+            }
+        }
+
+        overview.Update();
+        for (int slot = 0; slot < PadOverview::MAX_SLOTS; slot++) {
+            const PadSlotView& view = overview.GetSlot(slot);
+            if (hasDrawn[slot] && view.revision == drawnRevision[slot]) {
+                continue;
+            }
+            DrawOverviewPane(&frame, (slot % 2) * 40, 2 + (slot / 2) * 11, slot, view);
+            drawnRevision[slot] = view.revision;
+            hasDrawn[slot] = true;
+        }
+        frame.Present(hConsole);
+
+        Sleep(16);
+    }
+
+    cursorInfo.bVisible = TRUE;
+    SetConsoleCursorInfo(hConsole, &cursorInfo);
+    return 0;
+}
+
+// XeBbNOՃ[hiTvׂ͓͂Đς݁A`͖60Hzj
+// g: sample.exe --plot [cTv]
+int RunPlotMode(int argc, char* argv[]) {
+    constexpr uint64_t DRAW_INTERVAL_US = 16000;
+    constexpr int PLOT_LEFT_X = 10;
+    constexpr int PLOT_RIGHT_X = 50;
+    constexpr int PLOT_Y = 5;
+
+    int trailLength = (argc >= 1) ? atoi(argv[0]) : 512;
+    if (trailLength <= 0 || trailLength > StickPlot::MAX_TRAIL) {
+        printf("usage: --plot [trail 1-%d]\n", StickPlot::MAX_TRAIL);
+        return 1;
+    }
+    StickPlot leftPlot;
+    StickPlot rightPlot;
+    leftPlot.Initialize(trailLength, trailLength / 8);
+    rightPlot.Initialize(trailLength, trailLength / 8);
+
+    HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
+    CONSOLE_CURSOR_INFO cursorInfo;
+    GetConsoleCursorInfo(hConsole, &cursorInfo);
+    cursorInfo.bVisible = FALSE;
+    SetConsoleCursorInfo(hConsole, &cursorInfo);
+
+    ConsoleFrame frame;
+    frame.Print(0, 0, "===============================================================================");
+    frame.Print(0, 1, "                          STICK TRAJECTORY PLOT");
+    frame.Print(0, 2, "===============================================================================");
+    frame.Print(PLOT_LEFT_X, PLOT_Y - 1, "Left stick");
+    frame.Print(PLOT_RIGHT_X, PLOT_Y - 1, "Right stick");
+    frame.Print(0, 22, "-------------------------------------------------------------------------------");
+    frame.Print(0, 24, " ESC: Exit  |  D: Raw/Decoded  |  X: Clear trail");
+
+    // 1ms݂œǂ߂悤ɂĩ^C}[\Sleep(1)16msɂȂj
+    timeBeginPeriod(1);
+    GameController::Initialize();
+
+    bool isRaw = true;
+    bool hasLast = false;
+    float last[4] = {};
+    uint64_t nextDrawTime = 0;
+    uint64_t rateStartTime = GameController::GetTimeUs();
+    int rateSamples = 0;
+    float samplesPerSecond = 0.0f;
+    bool isRunning = true;
+
+    while (isRunning) {
+        GameController::Update();
+        const GamepadState& state = GameController::GetCurrentState();
+
+        // lςTvςށi~܂ĂԂ͋OՂcj
+        if (state.connected) {
+            float values[4];
+            if (isRaw) {
+                // ̒lYȂ̂ŉʌɔ]
+                const RawGamepad& raw = GameController::GetRawGamepad();
+                values[0] = raw.thumbLX / 32767.0f;
+                values[1] = -raw.thumbLY / 32767.0f;
+                values[2] = raw.thumbRX / 32767.0f;
+                values[3] = -raw.thumbRY / 32767.0f;
+            } else {
+                values[0] = state.leftStickX;
+                values[1] = state.leftStickY;
+                values[2] = state.rightStickX;
+                values[3] = state.rightStickY;
+            }
+            if (!hasLast || memcmp(values, last, sizeof(values)) != 0) {
+                leftPlot.AddSample(values[0], values[1]);
+                rightPlot.AddSample(values[2], values[3]);
+                memcpy(last, values, sizeof(values));
+                hasLast = true;
+                rateSamples++;
+            }
+        }
+
+        uint64_t now = GameController::GetUpdateTime();
+        if (now < nextDrawTime) {
+            Sleep(1);
+            continue;
+        }
+        nextDrawTime = now + DRAW_INTERVAL_US;
+
+        while (_kbhit()) {
+            int key = _getch();
+            if (key == 27) {
+                isRunning = false;
+            } else if (key == 'd' || key == 'D' || key == 'x' || key == 'X') {
+                if (key == 'd' || key == 'D') {
+                    isRaw = !isRaw;
+                }
+                leftPlot.Clear();
+                rightPlot.Clear();
+                hasLast = false;
+            }
+        }
+
+        if (now - rateStartTime >= 1000000) {
+            samplesPerSecond = rateSamples * 1000000.0f / (now - rateStartTime);
+            rateStartTime = now;
+            rateSamples = 0;
+        }
+        frame.Printf(0, 23, 0, " %-13s Mode: %-7s Samples/s:%5.0f  Trail %d, bright %d",
+            state.connected ? "Connected" : "Not connected", isRaw ? "Raw" : "Decoded",
+            samplesPerSecond, trailLength, trailLength / 8);
+
+        // g̕ɏȀɕς_
+        frame.Present(hConsole);
+        leftPlot.Present(hConsole, PLOT_LEFT_X, PLOT_Y);
+        rightPlot.Present(hConsole, PLOT_RIGHT_X, PLOT_Y);
+    }
+
+    GameController::Finalize();
+    timeEndPeriod(1);
+
+    cursorInfo.bVisible = TRUE;
+    SetConsoleCursorInfo(hConsole, &cursorInfo);
+    return 0;
+}
+
+//==============================================================================
+// vCEx`}[Np̓̓\[XƎ
+//==============================================================================
+static InputSample s_sourceSample;
+static DWORD s_sourcePacket = 0;
+static ULONGLONG s_sourceTime = 0;
+
+// s_sourceSampleuserIndex 0̃pbhƂĕԂ
+DWORD WINAPI SampleGetState(DWORD dwUserIndex, XINPUT_STATE* pState) {
+    if (dwUserIndex != 0 || !s_sourceSample.connected) {
+        return ERROR_DEVICE_NOT_CONNECTED;
+    }
+    const RawGamepad& pad = s_sourceSample.pad;
+    ZeroMemory(pState, sizeof(XINPUT_STATE));
+    pState->dwPacketNumber = s_sourcePacket;
+    pState->Gamepad.wButtons = pad.buttons;
+    pState->Gamepad.bLeftTrigger = pad.leftTrigger;
+    pState->Gamepad.bRightTrigger = pad.rightTrigger;
+    pState->Gamepad.sThumbLX = pad.thumbLX;
+    pState->Gamepad.sThumbLY = pad.thumbLY;
+    pState->Gamepad.sThumbRX = pad.thumbRX;
+    pState->Gamepad.sThumbRY = pad.thumbRY;
+    return ERROR_SUCCESS;
+}
+
+ULONGLONG SampleClock() {
+    return s_sourceTime;
+}
+
+// Tv1Update()i烁bZ[Wtruej
+bool FeedSample(const InputSample& sample, ChordDetector* pChords, char* pChordMessage, size_t messageSize) {
+    s_sourceSample = sample;
+    s_sourceTime = sample.timeUs;
+    s_sourcePacket++;
+    GameController::Update();
+
+    if (pChords->Update(GameController::GetButtonTracker()) > 0) {
+        strcpy_s(pChordMessage, messageSize, " Chord:");
+        for (int i = 0; i < pChords->GetEventCount(); i++) {
+            AppendEvent(pChordMessage, messageSize, " ");
+            AppendEvent(pChordMessage, messageSize, DEMO_CHORDS[pChords->GetEvent(i).chordId].pName);
+        }
+        return true;
+    }
+    return false;
+}
+
+// L^t@C̍Đ[hiʏ̃j^[\ŁA܂͑j
+// g: sample.exe --replay <file.xir> [x 1.0 ~ 100.0]
+int RunReplayMode(int argc, char* argv[]) {
+    double speed = (argc >= 2) ? atof(argv[1]) : 1.0;
+    if (argc < 1 || speed < 1.0 || speed > 100.0) {
+        printf("usage: --replay <file.xir> [speed 1-100]\n");
+        return 1;
+    }
+
+    InputRecordReader reader;
+    InputSample next;
+    if (!reader.Open(argv[0]) || !reader.Next(&next)) {
+        printf("cannot read %s\n", argv[0]);
+        return 1;
+    }
+    uint64_t startTime = next.timeUs;
+    double totalSeconds = (reader.GetEndTime() > startTime) ? (reader.GetEndTime() - startTime) / 1000000.0 : 0.0;
+
     HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
+    CONSOLE_CURSOR_INFO cursorInfo;
+    GetConsoleCursorInfo(hConsole, &cursorInfo);
+    cursorInfo.bVisible = FALSE;
+    SetConsoleCursorInfo(hConsole, &cursorInfo);
+
+    // L^̎̂܂܎\[XɂiԁE̔肪L^ƓɂȂj
+    s_sourceSample = next;
+    s_sourceTime = startTime;
+    GameController::SetStateSource(SampleGetState);
+    GameController::SetClockSource(SampleClock);
+    GameController::Initialize();
+
+    ChordDetector chords;
+    for (const ChordLabel& label : DEMO_CHORDS) {
+        chords.AddChord(label.buttons, ChordWindowFromFrames(label.frames));
+    }
+    char chordMessage[64] = "";
+    uint64_t chordMessageEnd = 0;
+
+    bool hasNext = true;
+    bool isPaused = false;
+    double positionUs = 0.0;
+    auto lastFrame = std::chrono::steady_clock::now();
+    bool isRunning = true;
+
+    while (isRunning) {
+        while (_kbhit()) {
+            int key = _getch();
+            if (key == 0 || key == 224) {
+                _getch();
+            } else if (key == 27) {
+                isRunning = false;
+            } else if (key == 'p' || key == 'P' || key == ' ') {
+                isPaused = !isPaused;
+            }
+        }
+
+        // oߎԂɑx|ʒu܂ł̃Tv1ił肱ڂȂj
+        auto now = std::chrono::steady_clock::now();
+        double elapsedUs = std::chrono::duration<double, std::micro>(now - lastFrame).count();
+        lastFrame = now;
+        if (!isPaused) {
+            positionUs += elapsedUs * speed;
+        }
+        while (hasNext && next.timeUs - startTime <= positionUs) {
+            if (FeedSample(next, &chords, chordMessage, sizeof(chordMessage))) {
+                chordMessageEnd = next.timeUs + CHORD_MESSAGE_US;
+            }
+            hasNext = reader.Next(&next);
+        }
+
+        char status[64];
+        double position = (s_sourceTime - startTime) / 1000000.0;
+        sprintf_s(status, sizeof(status), "REPLAY x%.1f  %.1fs / %.1fs%s", speed, position, totalSeconds,
+            !hasNext ? "  (end)" : (isPaused ? "  (paused)" : ""));
+        char info[160];
+        sprintf_s(info, sizeof(info), " Replay: %.40s  #%llu/%llu%s", argv[0],
+            static_cast<unsigned long long>(reader.GetFrame()),
+            static_cast<unsigned long long>(reader.GetSampleCount()),
+            (s_sourceTime < chordMessageEnd) ? chordMessage : "");
+
+        ClearScreen();
+        if (!GameController::IsConnected()) {
+            GamepadState empty;
+            DrawMonitor(empty, empty, "REPLAY (disconnected in recording)", info);
+        } else {
+            DrawMonitor(GameController::GetCurrentState(), GameController::GetPrevState(), status, info);
+        }
+        Sleep(16);
+    }
+
+    GameController::Finalize();
+    GameController::SetStateSource(nullptr);
+    GameController::SetClockSource(nullptr);
+
+    cursorInfo.bVisible = TRUE;
+    SetConsoleCursorInfo(hConsole, &cursorInfo);
+    return 0;
+}
+
+// ͂1t[iXeBbN͉񂵁A{^EgK[͎Iɉj
+void MakeSyntheticSample(uint64_t frame, InputSample* pSample) {
+    constexpr uint16_t BUTTON_CYCLE[] = {
+        0, PAD_BUTTON_A, PAD_BUTTON_A | PAD_BUTTON_B, PAD_BUTTON_DPAD_UP, 0,
+        PAD_BUTTON_LEFT_SHOULDER | PAD_BUTTON_RIGHT_SHOULDER, PAD_BUTTON_START, PAD_BUTTON_X | PAD_BUTTON_Y,
+    };
+    constexpr int CYCLE_COUNT = sizeof(BUTTON_CYCLE) / sizeof(BUTTON_CYCLE[0]);
+
+    float angle = static_cast<float>(frame % 360) * 0.0174533f;
+    pSample->timeUs = frame * 16667;
+    pSample->connected = true;
+    pSample->pad.buttons = BUTTON_CYCLE[(frame / 4) % CYCLE_COUNT];
+    pSample->pad.thumbLX = static_cast<int16_t>(std::cos(angle) * 30000.0f);
+    pSample->pad.thumbLY = static_cast<int16_t>(std::sin(angle) * 30000.0f);
+    pSample->pad.thumbRX = static_cast<int16_t>(std::sin(angle * 3.0f) * 20000.0f);
+    pSample->pad.thumbRY = static_cast<int16_t>(std::cos(angle * 2.0f) * 20000.0f);
+    pSample->pad.leftTrigger = static_cast<uint8_t>(frame * 7);
+    pSample->pad.rightTrigger = static_cast<uint8_t>(255 - frame * 5);
+}
+
+// j^[Ŝ̃x`}[Ni͂ŁAUpdate()Update(){\̑gݗĂ𑪂j
+// \͎̂Đ֏̂ŁA܂ł܂߃R\[ւ̏o͂͊܂܂Ȃ
+// g: sample.exe --bench [t[]
+int RunMonitorBenchmark(int argc, char* argv[]) {
+    long long frames = (argc >= 1) ? atoll(argv[0]) : 200000;
+    if (frames <= 0) {
+        printf("usage: --bench [frames]\n");
+        return 1;
+    }
+
+    FILE* pNull = nullptr;
+    if (fopen_s(&pNull, "NUL", "w") != 0 || pNull == nullptr) {
+        printf("cannot open NUL\n");
+        return 1;
+    }
+    static char s_nullBuffer[64 * 1024];
+    setvbuf(pNull, s_nullBuffer, _IOFBF, sizeof(s_nullBuffer));
+
+    GameController::SetStateSource(SampleGetState);
+    GameController::SetClockSource(SampleClock);
+
+    ChordDetector chords;
+    for (const ChordLabel& label : DEMO_CHORDS) {
+        chords.AddChord(label.buttons, ChordWindowFromFrames(label.frames));
+    }
+    char chordMessage[64] = "";
+
+    printf("monitor benchmark: %lld frames of synthetic input\n", frames);
+    double seconds[2] = {};
+    for (int pass = 0; pass < 2; pass++) {
+        bool withDisplay = (pass == 1);
+        InputSample sample;
+        MakeSyntheticSample(0, &sample);
+        s_sourceSample = sample;
+        s_sourceTime = 0;
+        GameController::Initialize();
+        chords.Reset();
+
+        auto begin = std::chrono::steady_clock::now();
+        for (long long frame = 0; frame < frames; frame++) {
+            MakeSyntheticSample(static_cast<uint64_t>(frame), &sample);
+            FeedSample(sample, &chords, chordMessage, sizeof(chordMessage));
+            if (withDisplay) {
+                s_pMonitorOut = pNull;
+                DrawMonitor(GameController::GetCurrentState(), GameController::GetPrevState(), "Benchmark", chordMessage);
+                s_pMonitorOut = nullptr;
+            }
+        }
+        seconds[pass] = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        GameController::Finalize();
+
+        printf("  %-18s %8.3f s  %10.0f frames/s  %8.1f ns/frame\n",
+            withDisplay ? "Update + display" : "Update only", seconds[pass],
+            frames / seconds[pass], seconds[pass] * 1e9 / frames);
+    }
+    printf("  display share      %7.1f %%\n",
+        (seconds[1] > 0.0) ? (seconds[1] - seconds[0]) / seconds[1] * 100.0 : 0.0);
+
+    GameController::SetStateSource(nullptr);
+    GameController::SetClockSource(nullptr);
+    fclose(pNull);
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc >= 2 && strcmp(argv[1], "--latency") == 0) {
+        return RunLatencyMode(argc - 2, argv + 2);
+    }
+    if (argc >= 2 && strcmp(argv[1], "--analyze") == 0) {
+        return RunAnalyzeMode(argc - 2, argv + 2);
+    }
+    if (argc >= 2 && strcmp(argv[1], "--tune") == 0) {
+        return RunTuneMode(argc - 2, argv + 2);
+    }
+    if (argc >= 2 && strcmp(argv[1], "--bench-controller") == 0) {
+        return RunControllerBenchmark();
+    }
+    if (argc >= 2 && strcmp(argv[1], "--bench-contention") == 0) {
+        return RunContentionBenchmark();
+    }
+    if (argc >= 2 && strcmp(argv[1], "--bench-state") == 0) {
+        return RunStateLayoutBenchmark();
+    }
+    if (argc >= 2 && strcmp(argv[1], "--bench-readers") == 0) {
+        return RunInputReaderBenchmark();
+    }
+    if (argc >= 2 && strcmp(argv[1], "--hid-decode") == 0) {
+        return RunHidDecodeMode(argc - 2, argv + 2);
+    }
+    if (argc >= 2 && strcmp(argv[1], "--overview") == 0) {
+        return RunOverviewMode();
+    }
+    if (argc >= 2 && strcmp(argv[1], "--plot") == 0) {
+        return RunPlotMode(argc - 2, argv + 2);
+    }
+    if (argc >= 2 && strcmp(argv[1], "--replay") == 0) {
+        return RunReplayMode(argc - 2, argv + 2);
+    }
+    if (argc >= 2 && strcmp(argv[1], "--bench") == 0) {
+        return RunMonitorBenchmark(argc - 2, argv + 2);
+    }
+
+    HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
+    HANDLE hInput = GetStdHandle(STD_INPUT_HANDLE);
 
     // EBhETCYݒ
     SMALL_RECT rect = { 0, 0, 79, 24 };
@@ -65,17 +995,77 @@ int main() {
     cursorInfo.bVisible = FALSE;
     SetConsoleCursorInfo(hConsole, &cursorInfo);
 
+    // --mergeȂ4XInputXbg1lɂ܂Ƃ߂ĕ\
+    // --keyboardȂL[{[hpbhƂĎgi--mergeƈꏏȂpbhƍ킹j
+    bool isMerged = false;
+    bool useKeyboard = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--merge") == 0) isMerged = true;
+        if (strcmp(argv[i], "--keyboard") == 0) useKeyboard = true;
+    }
+
+    KeyboardSource keyboard;
+    if (useKeyboard) {
+        useKeyboard = keyboard.Open();
+        KeyboardSource::Register(useKeyboard ? &keyboard : nullptr);
+    }
+
+    LogicalPlayer mergedPlayer;
+    if (isMerged) {
+        for (DWORD i = 0; i < XUSER_MAX_COUNT; i++) {
+            mergedPlayer.AddSource(nullptr, i);
+        }
+        if (useKeyboard) {
+            mergedPlayer.AddSource(KeyboardSource::GetStateFor, 0);
+        }
+        LogicalPlayer::Register(0, &mergedPlayer);
+        GameController::SetStateSource(LogicalPlayer::GetStateFor);
+    } else if (useKeyboard) {
+        GameController::SetStateSource(KeyboardSource::GetStateFor);
+    }
+    KeyboardSource* pHotkeySource = useKeyboard ? &keyboard : nullptr;
+
     GameController::Initialize();
 
-    char line[128];
-    char barLX[16], barLY[16], barRX[16], barRY[16];
-    char barLT[16], barRT[16];
+    // {^zuiLL[Ő؂ւj
+    ButtonLayoutType layoutType = BUTTON_LAYOUT_XBOX;
+    GameController::SetButtonLayout(layoutType);
+
+    // ÕLu[VΎg
+    GamepadCalibration calibration;
+    if (LoadCalibrationProfile(CALIBRATION_PATH, &calibration)) {
+        GameController::SetCalibration(calibration);
+    }
+    DeadzoneTuner tuner;
+    bool isCalibrating = false;
+    uint64_t calibrationEnd = 0;
+    char calibrationMessage[128] = "";
+
+    // iID͓o^Ȃ̂DEMO_CHORDS̓Yƈvj
+    ChordDetector chords;
+    for (const ChordLabel& label : DEMO_CHORDS) {
+        chords.AddChord(label.buttons, ChordWindowFromFrames(label.frames));
+    }
+    char chordMessage[64] = "";
+    uint64_t chordMessageEnd = 0;
+
+    // ͗iꎞ~L^͑j
+    InputHistory history;
+    history.Initialize(HISTORY_MEMORY_BYTES);
+
+    // L^t@C
+    InputRecordWriter recorder;
+    char recordPath[64] = "";
+
+    char historyInfo[128];
+    bool isPaused = false;
+    uint64_t viewTime = 0;
     bool isRunning = true;
 
     while (isRunning) {
         // L[͏
-        if (_kbhit()) {
-            int key = _getch();
+        int key = ReadHotkey(pHotkeySource);
+        if (key >= 0) {
             switch (key) {
             case 27:  // ESC
                 isRunning = false;
@@ -88,12 +1078,139 @@ int main() {
             case 'B':
                 GameController::StartVibration(0.3f, 0.3f);
                 break;
+            case 'r':
+            case 'R':
+                if (recorder.IsOpen()) {
+                    recorder.Close();
+                } else {
+                    MakeRecordFileName(recordPath, sizeof(recordPath));
+                    recorder.Open(recordPath);
+                }
+                break;
+            case 'l':
+            case 'L':
+                layoutType = static_cast<ButtonLayoutType>((layoutType + 1) % BUTTON_LAYOUT_COUNT);
+                GameController::SetButtonLayout(layoutType);
+                break;
+            case 'c':
+            case 'C':
+                tuner.Reset();
+                isCalibrating = true;
+                calibrationEnd = GameController::GetTimeUs() + CALIBRATION_CAPTURE_US;
+                break;
+            case 'p':
+            case 'P':
+                isPaused = !isPaused && history.GetCount() > 0;
+                viewTime = GetHistoryTime(history, true);
+                break;
+            case KEY_LEFT:
+                if (isPaused) viewTime = StepHistory(history, viewTime, -1);
+                break;
+            case KEY_RIGHT:
+                if (isPaused) viewTime = StepHistory(history, viewTime, 1);
+                break;
+            case KEY_DOWN:
+                if (isPaused) {
+                    uint64_t oldest = GetHistoryTime(history, false);
+                    viewTime = (viewTime > oldest + ONE_SECOND_US) ? viewTime - ONE_SECOND_US : oldest;
+                    viewTime = StepHistory(history, viewTime, 0);
+                }
+                break;
+            case KEY_UP:
+                if (isPaused) viewTime = StepHistory(history, viewTime + ONE_SECOND_US, 0);
+                break;
+            case KEY_HOME:
+                if (isPaused) viewTime = GetHistoryTime(history, false);
+                break;
+            case KEY_END:
+                if (isPaused) viewTime = GetHistoryTime(history, true);
+                break;
             }
         }
 
         GameController::Update();
+
+        InputSample sample;
+        sample.timeUs = GameController::GetUpdateTime();
+        sample.pad = GameController::GetRawGamepad();
+        sample.connected = GameController::IsConnected();
+        history.Push(sample);
+        recorder.Write(sample);
+
+        if (chords.Update(GameController::GetButtonTracker()) > 0) {
+            strcpy_s(chordMessage, sizeof(chordMessage), " Chord:");
+            for (int i = 0; i < chords.GetEventCount(); i++) {
+                AppendEvent(chordMessage, sizeof(chordMessage), " ");
+                AppendEvent(chordMessage, sizeof(chordMessage), DEMO_CHORDS[chords.GetEvent(i).chordId].pName);
+            }
+            chordMessageEnd = sample.timeUs + CHORD_MESSAGE_US;
+        }
+
+        // Lu[V͐Î~TvW߁AԂ琄肷
+        if (isCalibrating) {
+            tuner.AddSample(sample);
+            if (sample.timeUs >= calibrationEnd) {
+                isCalibrating = false;
+                calibrationEnd = sample.timeUs + CALIBRATION_MESSAGE_US;
+                if (tuner.Compute(&calibration)) {
+                    GameController::SetCalibration(calibration);
+                    SaveCalibrationProfile(CALIBRATION_PATH, calibration);
+                    char text[96];
+                    FormatCalibration(text, sizeof(text), calibration);
+                    sprintf_s(calibrationMessage, sizeof(calibrationMessage), " CAL: %s", text);
+                } else {
+                    sprintf_s(calibrationMessage, sizeof(calibrationMessage),
+                        " CAL: failed (sticks moved?)  rest samples %d", tuner.GetAcceptedSamples());
+                }
+            }
+        }
+
+        uint64_t newestTime = GetHistoryTime(history, true);
+        uint64_t oldestTime = GetHistoryTime(history, false);
+        if (recorder.IsOpen()) {
+            sprintf_s(historyInfo, sizeof(historyInfo), " History: %.1fs  |  REC %s  %llu samples / %lluKB",
+                (newestTime - oldestTime) / 1000000.0, recordPath,
+                static_cast<unsigned long long>(recorder.GetSampleCount()),
+                static_cast<unsigned long long>(recorder.GetByteCount() / 1024));
+        } else {
+            sprintf_s(historyInfo, sizeof(historyInfo), " History: %d samples / %.1fs / %zuKB of %zuKB",
+                history.GetCount(), (newestTime - oldestTime) / 1000000.0,
+                history.GetUsedBytes() / 1024, history.GetCapacityBytes() / 1024);
+        }
+        if (isCalibrating) {
+            sprintf_s(historyInfo, sizeof(historyInfo), " CAL: leave the sticks alone... %.1fs",
+                (calibrationEnd > sample.timeUs) ? (calibrationEnd - sample.timeUs) / 1000000.0 : 0.0);
+        } else if (calibrationMessage[0] != '\0' && sample.timeUs < calibrationEnd) {
+            strcpy_s(historyInfo, sizeof(historyInfo), calibrationMessage);
+        } else if (chordMessage[0] != '\0' && sample.timeUs < chordMessageEnd) {
+            strcpy_s(historyInfo, sizeof(historyInfo), chordMessage);
+        }
+
         ClearScreen();
 
+        if (isPaused) {
+            // \t[Ƃ̑Ot[𕜌
+            int index = history.FindIndexByTime(viewTime);
+            InputSample viewSample;
+            InputSample prevSample;
+            GamepadState state = {};
+            GamepadState prev = {};
+            if (index > 0 && history.GetSample(index - 1, &prevSample) && prevSample.connected) {
+                DecodeHistorySample(prevSample.pad, &prev);
+            }
+            if (history.GetSample(index, &viewSample) && viewSample.connected) {
+                DecodeHistorySample(viewSample.pad, &state);
+            }
+
+            char status[64];
+            sprintf_s(status, sizeof(status), "PAUSED  %+.3fs  #%d/%d%s",
+                -static_cast<double>(newestTime - viewSample.timeUs) / 1000000.0,
+                index + 1, history.GetCount(), viewSample.connected ? "" : "  (disconnected)");
+            DrawMonitor(state, prev, status, historyInfo);
+            Sleep(16);
+            continue;
+        }
+
         if (!GameController::IsConnected()) {
             PrintLine("===============================================================================");
             PrintLine("                    XINPUT CONTROLLER DEBUG MONITOR                            ");
@@ -103,138 +1220,33 @@ int main() {
             PrintLine("");
             PrintLine(" Waiting for XInput compatible controller (Xbox, etc.)");
             PrintLine("");
-            for (int i = 0; i < 13; i++) {
+            PrintLine(GameController::GetArrivalEvent() != nullptr ?
+                " Idle: sleeping until a device arrives" : " Idle: probing with backoff (no arrival notification)");
+            for (int i = 0; i < 12; i++) {
                 PrintLine("");
             }
             PrintLine("-------------------------------------------------------------------------------");
-            PrintLine(" ESC: Exit");
-            Sleep(100);
+            PrintLine(" ESC: Exit  |  P: Pause (review history)");
+            PrintLine(historyInfo);
+            WaitWhileDisconnected(hInput);
             continue;
         }
 
-        const GamepadState& state = GameController::GetCurrentState();
-
-        GetStickBar(barLX, sizeof(barLX), state.leftStickX);
-        GetStickBar(barLY, sizeof(barLY), state.leftStickY);
-        GetStickBar(barRX, sizeof(barRX), state.rightStickX);
-        GetStickBar(barRY, sizeof(barRY), state.rightStickY);
-        GetTriggerBar(barLT, sizeof(barLT), state.leftTrigger);
-        GetTriggerBar(barRT, sizeof(barRT), state.rightTrigger);
-
-        // {^\p
-        const char* pDpadUp = state.dpadUp ? "[U]" : " U ";
-        const char* pDpadDown = state.dpadDown ? "[D]" : " D ";
-        const char* pDpadLeft = state.dpadLeft ? "[L]" : " L ";
-        const char* pDpadRight = state.dpadRight ? "[R]" : " R ";
-
-        const char* pMainUp = state.buttonUp ? "[]" : "  ";
-        const char* pMainDown = state.buttonDown ? "[~]" : " ~ ";
-        const char* pMainLeft = state.buttonLeft ? "[]" : "  ";
-        const char* pMainRight = state.buttonRight ? "[]" : "  ";
-
-        const char* pBtnL1 = state.buttonL1 ? "[LB]" : " LB ";
-        const char* pBtnR1 = state.buttonR1 ? "[RB]" : " RB ";
-        const char* pBtnL2 = state.buttonL2 ? "[LT]" : " LT ";
-        const char* pBtnR2 = state.buttonR2 ? "[RT]" : " RT ";
-        const char* pBtnL3 = state.buttonL3 ? "[LS]" : " LS ";
-        const char* pBtnR3 = state.buttonR3 ? "[RS]" : " RS ";
-
-        const char* pBtnSelect = state.buttonSelect ? "[BACK]" : " BACK  ";
-        const char* pBtnStart = state.buttonStart ? "[START]" : " START ";
-
-        const char* pVibration = GameController::IsVibrating() ? "[VIBRATING]" : "           ";
-
-        PrintLine("===============================================================================");
-        PrintLine("                    XINPUT CONTROLLER DEBUG MONITOR                            ");
-        PrintLine("===============================================================================");
-
-        sprintf_s(line, sizeof(line), " Status: Connected                                           %s", pVibration);
-        PrintLine(line);
-
-        PrintLine("-------------------------------------------------------------------------------");
-
-        sprintf_s(line, sizeof(line), " L Stick | X:%6.2f %s   Y:%6.2f %s",
-            state.leftStickX, barLX, state.leftStickY, barLY);
-        PrintLine(line);
-
-        sprintf_s(line, sizeof(line), " R Stick | X:%6.2f %s   Y:%6.2f %s",
-            state.rightStickX, barRX, state.rightStickY, barRY);
-        PrintLine(line);
-
-        sprintf_s(line, sizeof(line), " Trigger | LT:%5.2f %s    RT:%5.2f %s",
-            state.leftTrigger, barLT, state.rightTrigger, barRT);
-        PrintLine(line);
-
-        PrintLine("-------------------------------------------------------------------------------");
-
-        sprintf_s(line, sizeof(line), "  D-PAD        %s                MAIN             %s", pDpadUp, pMainUp);
-        PrintLine(line);
-
-        sprintf_s(line, sizeof(line), "            %s   %s                           %s  %s",
-            pDpadLeft, pDpadRight, pMainLeft, pMainRight);
-        PrintLine(line);
-
-        sprintf_s(line, sizeof(line), "               %s                                 %s", pDpadDown, pMainDown);
-        PrintLine(line);
-
-        PrintLine("-------------------------------------------------------------------------------");
-
-        sprintf_s(line, sizeof(line), " Shoulder: %s %s                                     %s %s",
-            pBtnL1, pBtnL2, pBtnR2, pBtnR1);
-        PrintLine(line);
-
-        sprintf_s(line, sizeof(line), " Stick   : %s                                             %s",
-            pBtnL3, pBtnR3);
-        PrintLine(line);
-
-        sprintf_s(line, sizeof(line), " System  : %s                                      %s",
-            pBtnSelect, pBtnStart);
-        PrintLine(line);
-
-        PrintLine("-------------------------------------------------------------------------------");
-
-        char event[128] = " Event:";
-        if (GameController::IsTrigger_ButtonDown())  AppendEvent(event, sizeof(event), " A+");
-        if (GameController::IsTrigger_ButtonRight()) AppendEvent(event, sizeof(event), " B+");
-        if (GameController::IsTrigger_ButtonLeft())  AppendEvent(event, sizeof(event), " X+");
-        if (GameController::IsTrigger_ButtonUp())    AppendEvent(event, sizeof(event), " Y+");
-        if (GameController::IsTrigger_L1())          AppendEvent(event, sizeof(event), " LB+");
-        if (GameController::IsTrigger_R1())          AppendEvent(event, sizeof(event), " RB+");
-        if (GameController::IsTrigger_L2())          AppendEvent(event, sizeof(event), " LT+");
-        if (GameController::IsTrigger_R2())          AppendEvent(event, sizeof(event), " RT+");
-        if (GameController::IsTrigger_L3())          AppendEvent(event, sizeof(event), " LS+");
-        if (GameController::IsTrigger_R3())          AppendEvent(event, sizeof(event), " RS+");
-        if (GameController::IsTrigger_Start())       AppendEvent(event, sizeof(event), " START+");
-        if (GameController::IsTrigger_Select())      AppendEvent(event, sizeof(event), " BACK+");
-        if (GameController::IsTrigger_DpadUp())      AppendEvent(event, sizeof(event), " U+");
-        if (GameController::IsTrigger_DpadDown())    AppendEvent(event, sizeof(event), " D+");
-        if (GameController::IsTrigger_DpadLeft())    AppendEvent(event, sizeof(event), " L+");
-        if (GameController::IsTrigger_DpadRight())   AppendEvent(event, sizeof(event), " R+");
-        if (GameController::IsRelease_ButtonDown())  AppendEvent(event, sizeof(event), " A-");
-        if (GameController::IsRelease_ButtonRight()) AppendEvent(event, sizeof(event), " B-");
-        if (GameController::IsRelease_ButtonLeft())  AppendEvent(event, sizeof(event), " X-");
-        if (GameController::IsRelease_ButtonUp())    AppendEvent(event, sizeof(event), " Y-");
-        if (GameController::IsRelease_L1())          AppendEvent(event, sizeof(event), " LB-");
-        if (GameController::IsRelease_R1())          AppendEvent(event, sizeof(event), " RB-");
-        if (GameController::IsRelease_L2())          AppendEvent(event, sizeof(event), " LT-");
-        if (GameController::IsRelease_R2())          AppendEvent(event, sizeof(event), " RT-");
-        if (GameController::IsRelease_L3())          AppendEvent(event, sizeof(event), " LS-");
-        if (GameController::IsRelease_R3())          AppendEvent(event, sizeof(event), " RS-");
-        if (GameController::IsRelease_Start())       AppendEvent(event, sizeof(event), " START-");
-        if (GameController::IsRelease_Select())      AppendEvent(event, sizeof(event), " BACK-");
-        if (GameController::IsRelease_DpadUp())      AppendEvent(event, sizeof(event), " U-");
-        if (GameController::IsRelease_DpadDown())    AppendEvent(event, sizeof(event), " D-");
-        if (GameController::IsRelease_DpadLeft())    AppendEvent(event, sizeof(event), " L-");
-        if (GameController::IsRelease_DpadRight())   AppendEvent(event, sizeof(event), " R-");
-        PrintLine(event);
-
-        PrintLine("===============================================================================");
-        PrintLine(" ESC: Exit  |  V: Vibration Strong  |  B: Vibration Weak");
+        char status[32] = "Connected";
+        if (isMerged) {
+            sprintf_s(status, sizeof(status), "Merged (slots 0x%X)", mergedPlayer.GetConnectedMask());
+        } else if (useKeyboard) {
+            strcpy_s(status, sizeof(status), "Keyboard (WASD/1234/arrows)");
+        }
+        DrawMonitor(GameController::GetCurrentState(), GameController::GetPrevState(), status, historyInfo);
 
         Sleep(16);
     }
 
+    recorder.Close();
     GameController::Finalize();
+    KeyboardSource::Register(nullptr);
+    keyboard.Close();
 
     cursorInfo.bVisible = TRUE;
     SetConsoleCursorInfo(hConsole, &cursorInfo);
@@ -0,0 +1,121 @@
+/*****************************************************************//**
+ * \file   mapped_file.cpp
+ * \brief  ǂݎp̃}bvht@C
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "mapped_file.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+//==============================================================================
+// JiWindowsj
+//==============================================================================
+bool MappedFile::Open(const char* pPath) {
+    Close();
+
+    HANDLE hFile = CreateFileA(pPath, GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (hFile == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(hFile, &size) || size.QuadPart == 0) {
+        CloseHandle(hFile);
+        return false;
+    }
+
+    HANDLE hMapping = CreateFileMappingA(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (hMapping == nullptr) {
+        CloseHandle(hFile);
+        return false;
+    }
+
+    void* pView = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+    if (pView == nullptr) {
+        CloseHandle(hMapping);
+        CloseHandle(hFile);
+        return false;
+    }
+
+    m_hFile = hFile;
+    m_hMapping = hMapping;
+    m_pData = static_cast<const uint8_t*>(pView);
+    m_size = static_cast<size_t>(size.QuadPart);
+    return true;
+}
+
+//==============================================================================
+// iWindowsj
+//==============================================================================
+void MappedFile::Close() {
+    if (m_pData != nullptr) {
+        UnmapViewOfFile(m_pData);
+    }
+    if (m_hMapping != nullptr) {
+        CloseHandle(m_hMapping);
+    }
+    if (m_hFile != nullptr) {
+        CloseHandle(m_hFile);
+    }
+    m_pData = nullptr;
+    m_size = 0;
+    m_hMapping = nullptr;
+    m_hFile = nullptr;
+}
+
+#else
+//==============================================================================
+// JiPOSIXj
+//==============================================================================
+bool MappedFile::Open(const char* pPath) {
+    Close();
+
+    int fd = open(pPath, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+
+    void* pView = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    if (pView == MAP_FAILED) {
+        close(fd);
+        return false;
+    }
+    madvise(pView, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+
+    m_fd = fd;
+    m_pData = static_cast<const uint8_t*>(pView);
+    m_size = static_cast<size_t>(st.st_size);
+    return true;
+}
+
+//==============================================================================
+// iPOSIXj
+//==============================================================================
+void MappedFile::Close() {
+    if (m_pData != nullptr) {
+        munmap(const_cast<uint8_t*>(m_pData), m_size);
+    }
+    if (m_fd >= 0) {
+        close(m_fd);
+    }
+    m_pData = nullptr;
+    m_size = 0;
+    m_fd = -1;
+}
+#endif
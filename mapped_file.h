@@ -0,0 +1,38 @@
+/*****************************************************************//**
+ * \file   mapped_file.h
+ * \brief  ǂݎp̃}bvht@C
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+//==============================================================================
+// }bvht@CNX
+//==============================================================================
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile() { Close(); }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Open(const char* pPath);
+    void Close();
+
+    bool IsOpen() const { return m_pData != nullptr; }
+    const uint8_t* GetData() const { return m_pData; }
+    size_t GetSize() const { return m_size; }
+
+private:
+    const uint8_t* m_pData = nullptr;
+    size_t m_size = 0;
+
+#ifdef _WIN32
+    void* m_hFile = nullptr;
+    void* m_hMapping = nullptr;
+#else
+    int m_fd = -1;
+#endif
+};
@@ -0,0 +1,124 @@
+/*****************************************************************//**
+ * \file   pad_overview.cpp
+ * \brief  4XInputXbg܂Ƃ߂Čꗗ
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "pad_overview.h"
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // ȂĂȂXbgǂݒԊu
+    constexpr uint64_t RETRY_INTERVAL_US = 1000000;
+    // obe[₢킹Ԋu
+    constexpr uint64_t BATTERY_INTERVAL_US = 5000000;
+    // v܂Ƃ߂Ԋu
+    constexpr uint64_t STATS_INTERVAL_US = 1000000;
+}
+
+//==============================================================================
+// XV
+//==============================================================================
+void PadOverview::Update() {
+    uint64_t timeUs = GameController::GetTimeUs();
+    if (!m_hasStarted) {
+        m_statsStartTime = timeUs;
+        m_hasStarted = true;
+    }
+
+    for (int slot = 0; slot < MAX_SLOTS; slot++) {
+        Slot& current = m_slots[slot];
+        if (!current.view.connected && timeUs < current.nextReadTime) {
+            continue;
+        }
+
+        // ǂݍ݂̎Ԃ͑O̎̍őĩXbg̊Jn˂j
+        ReadSlot(slot, timeUs);
+        uint64_t endTime = GameController::GetTimeUs();
+        current.readCostUs += endTime - timeUs;
+        timeUs = endTime;
+
+        if (current.view.connected && m_pSource == nullptr && timeUs >= current.nextBatteryTime) {
+            UpdateBattery(slot, timeUs);
+        }
+    }
+
+    if (timeUs - m_statsStartTime >= STATS_INTERVAL_US) {
+        PublishStats(timeUs);
+    }
+}
+
+void PadOverview::ReadSlot(int slot, uint64_t timeUs) {
+    Slot& current = m_slots[slot];
+    PadSlotView& view = current.view;
+    current.pollCount++;
+
+    StateSourceFunc pFunc = (m_pSource != nullptr) ? m_pSource : XInputBackend::GetState;
+    XINPUT_STATE state;
+    if (pFunc(static_cast<DWORD>(slot), &state) != ERROR_SUCCESS) {
+        if (view.connected) {
+            view.connected = false;
+            view.state = GamepadState();
+            view.battery = BatteryInfo();
+            view.revision++;
+            m_connectedMask &= ~(1u << slot);
+        }
+        current.nextReadTime = timeUs + RETRY_INTERVAL_US;
+        return;
+    }
+
+    if (!view.connected) {
+        view.connected = true;
+        view.packetNumber = state.dwPacketNumber - 1;   // Ȃ͕KfR[h
+        current.nextBatteryTime = timeUs;
+        m_connectedMask |= 1u << slot;
+    }
+    if (state.dwPacketNumber == view.packetNumber) {
+        return;
+    }
+
+    RawGamepad raw;
+    raw.buttons = state.Gamepad.wButtons;
+    raw.leftTrigger = state.Gamepad.bLeftTrigger;
+    raw.rightTrigger = state.Gamepad.bRightTrigger;
+    raw.thumbLX = state.Gamepad.sThumbLX;
+    raw.thumbLY = state.Gamepad.sThumbLY;
+    raw.thumbRX = state.Gamepad.sThumbRX;
+    raw.thumbRY = state.Gamepad.sThumbRY;
+    DecodeGamepad(raw, &view.state);
+
+    view.packetNumber = state.dwPacketNumber;
+    view.revision++;
+    current.packetCount++;
+}
+
+void PadOverview::UpdateBattery(int slot, uint64_t timeUs) {
+    Slot& current = m_slots[slot];
+    current.nextBatteryTime = timeUs + BATTERY_INTERVAL_US;
+
+    XINPUT_BATTERY_INFORMATION batteryInfo;
+    BatteryInfo battery;
+    if (XInputBackend::GetBatteryInformation(static_cast<DWORD>(slot), BATTERY_DEVTYPE_GAMEPAD, &batteryInfo) == ERROR_SUCCESS) {
+        battery = MakeBatteryInfo(batteryInfo);
+    }
+    current.view.battery = battery;
+    current.view.revision++;
+}
+
+void PadOverview::PublishStats(uint64_t timeUs) {
+    float seconds = static_cast<float>(timeUs - m_statsStartTime) / 1000000.0f;
+    for (Slot& current : m_slots) {
+        PadSlotStats& stats = current.view.stats;
+        stats.pollsPerSecond = current.pollCount / seconds;
+        stats.packetsPerSecond = current.packetCount / seconds;
+        stats.readCostUs = (current.pollCount > 0) ?
+            static_cast<float>(current.readCostUs) / current.pollCount : 0.0f;
+        current.pollCount = 0;
+        current.packetCount = 0;
+        current.readCostUs = 0;
+        current.view.revision++;
+    }
+    m_statsStartTime = timeUs;
+}
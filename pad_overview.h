@@ -0,0 +1,82 @@
+/*****************************************************************//**
+ * \file   pad_overview.h
+ * \brief  4XInputXbg܂Ƃ߂Čꗗ
+ *
+ * QA4lvCpBGameController1䂾ǂ̂ŁA͑SXbg
+ * œǂ݁AXbgƂɏԁEobe[Eǂݍ݂̓vB
+ *
+ * yۂ߂̍Hv
+ *   - ȂĂȂXbg1b1񂾂ǂށi󂫃Xbg̓ǂݍ݂͏dj
+ *   - obe[͂ȂƂƁǍ͐b1񂾂₢킹
+ *   - v1bƂɂ܂Ƃ߂čXV
+ *   - \ɊւlςƂXbg̃rWi߂
+ *     i`摤̓rWXbggݗĒȂĂ悢j
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include <windows.h>
+#include <Xinput.h>
+#include <cstdint>
+#include "game_controller.h"
+
+//==============================================================================
+// Xbg̓ǂݍݓvi1bƂɍXVj
+//==============================================================================
+struct PadSlotStats {
+    float pollsPerSecond = 0.0f;    // ۂɓǂ񂾉
+    float packetsPerSecond = 0.0f;  // ͂ς񐔁idwPacketNumberi񂾉񐔁j
+    float readCostUs = 0.0f;        // 1̓ǂݍ݂ɂώ
+};
+
+//==============================================================================
+// Xbg̕\e
+//==============================================================================
+struct PadSlotView {
+    bool connected = false;
+    GamepadState state;             // ̃Lu[VŃfR[hl
+    BatteryInfo battery;
+    PadSlotStats stats;
+    DWORD packetNumber = 0;
+    uint32_t revision = 0;          // \Ɋւlς邽тɐi
+};
+
+//==============================================================================
+// 4XbgꗗNX
+//==============================================================================
+class PadOverview {
+public:
+    static constexpr int MAX_SLOTS = XUSER_MAX_COUNT;
+
+    // ǂݍ݌inullptrXInputGetStateAւƂ̓obe[₢킹Ȃj
+    void SetStateSource(StateSourceFunc pFunc) { m_pSource = pFunc; }
+
+    // SXbgǂށiGameController::GetTimeUs()j
+    void Update();
+
+    const PadSlotView& GetSlot(int slot) const { return m_slots[slot].view; }
+    // ȂĂXbgirbgƁj
+    uint32_t GetConnectedMask() const { return m_connectedMask; }
+
+private:
+    struct Slot {
+        PadSlotView view;
+        uint64_t nextReadTime;      // ȂĂȂԂ̎̓ǂݍݎ
+        uint64_t nextBatteryTime;
+
+        // v̏Wv̒l
+        uint32_t pollCount;
+        uint32_t packetCount;
+        uint64_t readCostUs;
+    };
+
+    void ReadSlot(int slot, uint64_t timeUs);
+    void UpdateBattery(int slot, uint64_t timeUs);
+    void PublishStats(uint64_t timeUs);
+
+    StateSourceFunc m_pSource = nullptr;
+    Slot m_slots[MAX_SLOTS] = {};
+    uint32_t m_connectedMask = 0;
+    uint64_t m_statsStartTime = 0;
+    bool m_hasStarted = false;
+};
@@ -0,0 +1,96 @@
+/*****************************************************************//**
+ * \file   pad_state_board.cpp
+ * \brief  Tv[XbhQ[Xbhւ̃pbhԂ̎󂯓n
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "pad_state_board.h"
+#include <cstring>
+#include <thread>
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // ݒ̃V[PXƂA炸ɑ҂
+    // iRAȂƏ肪RAŎ~܂Ă邱Ƃj
+    constexpr int SPIN_BEFORE_YIELD = 64;
+}
+
+//==============================================================================
+// 1䕪̎󂯓n
+//==============================================================================
+void PadStateCell::Publish(const CompactGamepadState& state, uint64_t timeUs) {
+    uint64_t words[2];
+    memcpy(words, &state, sizeof(words));
+
+    // ̊Ԃ͏ݒ
+    uint32_t sequence = m_sequence.load(std::memory_order_relaxed);
+    m_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_words[0].store(words[0], std::memory_order_relaxed);
+    m_words[1].store(words[1], std::memory_order_relaxed);
+    m_words[2].store(timeUs, std::memory_order_relaxed);
+    m_sequence.store(sequence + 2, std::memory_order_release);
+}
+
+uint32_t PadStateCell::Read(CompactGamepadState* pState, uint64_t* pTimeUs) const {
+    uint64_t words[3];
+    uint32_t sequence;
+    int spins = 0;
+    for (;;) {
+        sequence = m_sequence.load(std::memory_order_acquire);
+        if ((sequence & 1) == 0) {
+            words[0] = m_words[0].load(std::memory_order_relaxed);
+            words[1] = m_words[1].load(std::memory_order_relaxed);
+            words[2] = m_words[2].load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_sequence.load(std::memory_order_relaxed) == sequence) {
+                break;
+            }
+        }
+        if (++spins >= SPIN_BEFORE_YIELD) {
+            spins = 0;
+            std::this_thread::yield();
+        }
+    }
+
+    if (pState != nullptr) {
+        memcpy(pState, words, sizeof(CompactGamepadState));
+    }
+    if (pTimeUs != nullptr) {
+        *pTimeUs = words[2];
+    }
+    return sequence;
+}
+
+//==============================================================================
+// ݑ
+//==============================================================================
+bool PadStateBoard::Submit(int pad, const CompactGamepadState& state, uint64_t timeUs) {
+    WriterSlot& writer = m_writer[pad];
+    writer.submitCount++;
+
+    // ͑O̒lȂ̂ŕKJ
+    if (writer.publishCount > 0 && memcmp(&writer.last, &state, sizeof(CompactGamepadState)) == 0) {
+        return false;
+    }
+    writer.last = state;
+    writer.publishCount++;
+    m_shared[pad].cell.Publish(state, timeUs);
+    return true;
+}
+
+//==============================================================================
+// ǂݎ葤
+//==============================================================================
+bool PadStateReader::Read(int pad, CompactGamepadState* pState) {
+    uint32_t sequence = m_pBoard->Read(pad, pState, nullptr);
+    m_readCount++;
+    if (sequence == m_lastSequence[pad]) {
+        return false;
+    }
+    m_lastSequence[pad] = sequence;
+    m_updateCount++;
+    return true;
+}
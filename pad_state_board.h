@@ -0,0 +1,109 @@
+/*****************************************************************//**
+ * \file   pad_state_board.h
+ * \brief  Tv[XbhQ[Xbhւ̃pbhԂ̎󂯓n
+ *
+ * ݂1XbhiTv[jAǂݎ͉Xbhł悢B
+ * 1䕪̏Ԃ̓V[PXbNœn̂ŁAǂݎ͏~߂ȂB
+ *
+ * LbVC̎荇邽߁AuꏊŕB
+ *   EǂݎƋLJς݂̏ c pbhƂ1s
+ *   E肾񏑂L^iO̒lE񐔁jc pbhƂɕʂ1s
+ *   Eǂݎ育Ƃ̋L^iÕV[PXE񐔁jc PadStateReaderƂ1s
+ * ωȂΌJȂ̂ŁA~܂Ăpbh̍s͓ǂݎ
+ * LbVɍڂ܂܂ɂȂB
+ *
+ * PadStateBoardPadStateReader̓LbVCEɑĂ̂ŁA
+ * ÓIϐX^bNɒuiC++14new͑ĂȂjB
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "gamepad_state.h"
+
+// LbVC̑傫ix86EARM̎CPUj
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+//==============================================================================
+// 1䕪̎󂯓niV[PXbNA݂1Xbhj
+//==============================================================================
+class PadStateCell {
+public:
+    void Publish(const CompactGamepadState& state, uint64_t timeUs);
+
+    // ݒȂI܂ő҂ēǂށA߂l̓V[PXԍiAĴтɑj
+    uint32_t Read(CompactGamepadState* pState, uint64_t* pTimeUs) const;
+    uint32_t GetSequence() const { return m_sequence.load(std::memory_order_acquire); }
+
+private:
+    std::atomic<uint32_t> m_sequence{ 0 };
+    // 16oCgƌJiǂݎƏ肪ɐĜatomičɕĎj
+    std::atomic<uint64_t> m_words[3] = {};
+};
+
+//==============================================================================
+// pbhԂ̎󂯓n
+//==============================================================================
+class PadStateBoard {
+public:
+    static constexpr int MAX_PADS = 4;
+
+    PadStateBoard() = default;
+    PadStateBoard(const PadStateBoard&) = delete;
+    PadStateBoard& operator=(const PadStateBoard&) = delete;
+
+    //==========================================================================
+    // ݑiTv[XbhĂԁj
+    //==========================================================================
+    // O񂩂ςĂΌJtrue
+    bool Submit(int pad, const CompactGamepadState& state, uint64_t timeUs);
+    uint64_t GetSubmitCount(int pad) const { return m_writer[pad].submitCount; }
+    uint64_t GetPublishCount(int pad) const { return m_writer[pad].publishCount; }
+
+    //==========================================================================
+    // ǂݎ葤iǂ̃Xbhł悢j
+    //==========================================================================
+    uint32_t Read(int pad, CompactGamepadState* pState, uint64_t* pTimeUs) const {
+        return m_shared[pad].cell.Read(pState, pTimeUs);
+    }
+    uint32_t GetSequence(int pad) const { return m_shared[pad].cell.GetSequence(); }
+
+private:
+    // ǂݎƋLiJƂj
+    struct alignas(CACHE_LINE_SIZE) SharedSlot {
+        PadStateCell cell;
+    };
+
+    // 肾Giôтɏ̂ŋLsƕj
+    struct alignas(CACHE_LINE_SIZE) WriterSlot {
+        CompactGamepadState last;
+        uint64_t submitCount = 0;
+        uint64_t publishCount = 0;
+    };
+
+    SharedSlot m_shared[MAX_PADS];
+    WriterSlot m_writer[MAX_PADS];
+};
+
+//==============================================================================
+// ǂݎ育Ƃ̏ԁiQ[XbhƂ1j
+//==============================================================================
+class alignas(CACHE_LINE_SIZE) PadStateReader {
+public:
+    PadStateReader() = default;
+    explicit PadStateReader(const PadStateBoard* pBoard) : m_pBoard(pBoard) {}
+    void SetBoard(const PadStateBoard* pBoard) { m_pBoard = pBoard; }
+
+    // O񂱂ReaderœǂłJĂtrueiԂ͂ǂłŐVԂj
+    bool Read(int pad, CompactGamepadState* pState);
+    uint64_t GetReadCount() const { return m_readCount; }
+    uint64_t GetUpdateCount() const { return m_updateCount; }
+
+private:
+    const PadStateBoard* m_pBoard = nullptr;
+    uint32_t m_lastSequence[PadStateBoard::MAX_PADS] = {};
+    uint64_t m_readCount = 0;
+    uint64_t m_updateCount = 0;
+};
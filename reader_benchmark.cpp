@@ -0,0 +1,218 @@
+/*****************************************************************//**
+ * \file   reader_benchmark.cpp
+ * \brief  epollłio_uringł̕foCXǂݍ݂̑xriLinuxj
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "reader_benchmark.h"
+#include <cstdio>
+
+#ifdef __linux__
+#include <chrono>
+#include <fcntl.h>
+#include <unistd.h>
+#include "epoll_reader.h"
+#include "uring_reader.h"
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // vt[ƁA鑤1䂠1t[̃|[g
+    constexpr int FRAME_COUNT = 5000;
+    constexpr int REPORTS_PER_FRAME = 4;
+
+    // UfoCX̃fBXNv^[iXeBbN48rbgEnbgE{^12A|[gIDȂj
+    const uint8_t FAKE_DESCRIPTOR[] = {
+        0x05, 0x01, 0x09, 0x05, 0xA1, 0x01,
+        0x09, 0x30, 0x09, 0x31, 0x09, 0x32, 0x09, 0x35,
+        0x15, 0x00, 0x26, 0xFF, 0x00, 0x75, 0x08, 0x95, 0x04, 0x81, 0x02,
+        0x09, 0x39, 0x15, 0x00, 0x25, 0x07, 0x75, 0x04, 0x95, 0x01, 0x81, 0x42,
+        0x05, 0x09, 0x19, 0x01, 0x29, 0x0C, 0x15, 0x00, 0x25, 0x01, 0x75, 0x01, 0x95, 0x0C, 0x81, 0x02,
+        0xC0,
+    };
+    constexpr size_t FAKE_REPORT_SIZE = 6;
+
+    // vgݍ킹iȂł䐔AĂ䐔j
+    struct BenchConfig {
+        int deviceCount;
+        int activeCount;
+    };
+    const BenchConfig CONFIGS[] = {
+        { 16, 0 },
+        { 16, 2 },
+        { 64, 8 },
+        { 64, 64 },
+    };
+
+    struct BenchResult {
+        double nsPerFrame;
+        double syscallsPerFrame;
+        uint64_t reports;
+    };
+
+    //==========================================================================
+    // pCvōUfoCXQ
+    //==========================================================================
+    struct FakeDevices {
+        HidrawDevice devices[EpollInputReader::MAX_DEVICES];
+        int writeFds[EpollInputReader::MAX_DEVICES];
+        int count = 0;
+
+        bool Open(int deviceCount) {
+            for (int i = 0; i < deviceCount; i++) {
+                int fds[2];
+                if (pipe2(fds, O_NONBLOCK | O_CLOEXEC) < 0) {
+                    return false;
+                }
+                writeFds[i] = fds[1];
+                devices[i].Attach(fds[0], FAKE_DESCRIPTOR, sizeof(FAKE_DESCRIPTOR));
+                count++;
+            }
+            return true;
+        }
+
+        ~FakeDevices() {
+            for (int i = 0; i < count; i++) {
+                close(writeFds[i]);
+            }
+        }
+
+        // 鑤̑䐔|[giXeBbNXɃt[ԍj
+        void Send(int activeCount, int frame) {
+            uint8_t reports[FAKE_REPORT_SIZE * REPORTS_PER_FRAME];
+            for (int r = 0; r < REPORTS_PER_FRAME; r++) {
+                uint8_t* pReport = reports + r * FAKE_REPORT_SIZE;
+                pReport[0] = static_cast<uint8_t>(frame);
+                pReport[1] = 0x80;
+                pReport[2] = 0x80;
+                pReport[3] = 0x80;
+                pReport[4] = 0x08;
+                pReport[5] = static_cast<uint8_t>(r);
+            }
+            for (int i = 0; i < activeCount; i++) {
+                // hidrawƓ1|[g͂悤ɕď
+                for (int r = 0; r < REPORTS_PER_FRAME; r++) {
+                    if (write(writeFds[i], reports + r * FAKE_REPORT_SIZE, FAKE_REPORT_SIZE) < 0) {
+                        return;
+                    }
+                }
+            }
+        }
+
+        // ǂݍݑtɌvƂɁA͂̂Ă
+        void Drain(int activeCount) {
+            uint8_t buffer[256];
+            for (int i = 0; i < activeCount; i++) {
+                while (read(devices[i].GetFd(), buffer, sizeof(buffer)) > 0) {
+                }
+            }
+        }
+
+        uint64_t CountReports() const {
+            uint64_t total = 0;
+            for (int i = 0; i < count; i++) {
+                total += devices[i].GetReportCount();
+            }
+            return total;
+        }
+    };
+
+    //==========================================================================
+    // v
+    //==========================================================================
+    // ݂1t[̎ԁiǂݍݑtÂĂ̂͌v̊Oj
+    double MeasureSendOnly(const BenchConfig& config) {
+        FakeDevices fake;
+        if (!fake.Open(config.deviceCount)) {
+            return 0.0;
+        }
+
+        std::chrono::steady_clock::duration elapsed(0);
+        for (int frame = 0; frame < FRAME_COUNT; frame++) {
+            auto begin = std::chrono::steady_clock::now();
+            fake.Send(config.activeCount, frame);
+            elapsed += std::chrono::steady_clock::now() - begin;
+            fake.Drain(config.activeCount);
+        }
+        return std::chrono::duration<double, std::nano>(elapsed).count() / FRAME_COUNT;
+    }
+
+    // ݁{Poll()̎Ԃ珑݂̎ԂiReaderEpollInputReaderUringInputReaderj
+    // io_uring͏oĂǂݍ݂write()̒Ŋ̂ŁAPoll()vƓǂݍ݂̕
+    template<typename Reader>
+    bool Measure(const BenchConfig& config, double sendNs, BenchResult* pResult, uint64_t (*pSyscalls)(const Reader&)) {
+        FakeDevices fake;
+        Reader reader;
+        if (!fake.Open(config.deviceCount) || !reader.Initialize()) {
+            return false;
+        }
+        for (int i = 0; i < config.deviceCount; i++) {
+            reader.AddDevice(&fake.devices[i]);
+        }
+        reader.Poll(0);
+        uint64_t syscallsBefore = pSyscalls(reader);
+
+        std::chrono::steady_clock::duration elapsed(0);
+        for (int frame = 0; frame < FRAME_COUNT; frame++) {
+            auto begin = std::chrono::steady_clock::now();
+            fake.Send(config.activeCount, frame);
+            reader.Poll(0);
+            elapsed += std::chrono::steady_clock::now() - begin;
+        }
+
+        pResult->nsPerFrame = std::chrono::duration<double, std::nano>(elapsed).count() / FRAME_COUNT - sendNs;
+        pResult->syscallsPerFrame = static_cast<double>(pSyscalls(reader) - syscallsBefore) / FRAME_COUNT;
+        pResult->reports = fake.CountReports();
+        return true;
+    }
+
+    // epollepoll_wait()ƁANfoCXƂread()if[^{EAGAIN2j
+    uint64_t EpollSyscalls(const EpollInputReader& reader) {
+        return reader.GetWaitCount() + reader.GetWakeCount() * 2;
+    }
+
+    uint64_t UringSyscalls(const UringInputReader& reader) {
+        return reader.GetEnterCount();
+    }
+}
+
+//==============================================================================
+// x`}[Ns
+//==============================================================================
+int RunInputReaderBenchmark() {
+    printf(" devices  active |   epoll ns/frame  syscalls |  io_uring ns/frame  syscalls | reports\n");
+    printf("-----------------+---------------------------+------------------------------+---------\n");
+    for (const BenchConfig& config : CONFIGS) {
+        BenchResult epoll = {};
+        BenchResult uring = {};
+        double sendNs = MeasureSendOnly(config);
+        if (!Measure<EpollInputReader>(config, sendNs, &epoll, EpollSyscalls)) {
+            printf("epoll reader could not be initialized\n");
+            return 1;
+        }
+        if (!Measure<UringInputReader>(config, sendNs, &uring, UringSyscalls)) {
+            printf("io_uring is not available on this system\n");
+            return 1;
+        }
+
+        // ƂS󂯎Ă邩
+        uint64_t expected = static_cast<uint64_t>(config.activeCount) * REPORTS_PER_FRAME * FRAME_COUNT;
+        bool complete = (epoll.reports == expected && uring.reports == expected);
+        printf(" %7d  %6d | %16.0f  %8.1f | %18.0f  %8.1f | %s\n",
+            config.deviceCount, config.activeCount,
+            epoll.nsPerFrame, epoll.syscallsPerFrame,
+            uring.nsPerFrame, uring.syscallsPerFrame,
+            complete ? "ok" : "MISSING");
+    }
+    return 0;
+}
+
+#else
+
+int RunInputReaderBenchmark() {
+    printf("the input reader benchmark needs Linux (epoll / io_uring)\n");
+    return 1;
+}
+
+#endif // __linux__
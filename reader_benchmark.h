@@ -0,0 +1,15 @@
+/*****************************************************************//**
+ * \file   reader_benchmark.h
+ * \brief  epollłio_uringł̕foCXǂݍ݂̑xriLinuxj
+ *
+ * pCvŨfoCXɂāAꕔ̑䐔ɖt[|[g݁A
+ * 1t[̓ǂݍ݂̎ԂƃVXeR[̉񐔂ׂB
+ * io_uring͓ǂݍ݂ݑwrite()̒ŏÎŁA݁{Poll()
+ * ܂Ƃ߂ČvAǂݍݑȂŌv݂̎ԂB
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+
+// x`}[NsČʂ\iLinuxȊOEio_uringgȂ1Ԃj
+int RunInputReaderBenchmark();
@@ -0,0 +1,140 @@
+/*****************************************************************//**
+ * \file   state_benchmark.cpp
+ * \brief  obt@ɒuԂ̌`̑xriGamepadStateCompactGamepadStatej
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "state_benchmark.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "gamepad_state.h"
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // vC[1l̗t[i2ׂ̂j
+    constexpr int PLAYER_COUNT = 4;
+    constexpr int HISTORY_FRAMES = 16384;
+    // ރt[ijƁAǂݕԂ
+    constexpr int WRITE_FRAMES = 1 << 20;
+    constexpr int SCAN_PASSES = 64;
+    // ͂̐i2ׂ̂j
+    constexpr int SOURCE_STATES = 1024;
+
+    // œKŏȂ悤ʂł
+    volatile float s_sink = 0.0f;
+
+    //==========================================================================
+    // ́i̒lfR[hčj
+    //==========================================================================
+    void BuildSource(std::vector<GamepadState>* pStates) {
+        pStates->resize(SOURCE_STATES);
+        unsigned int seed = 12345;
+        for (int i = 0; i < SOURCE_STATES; i++) {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+
+            float angle = i * (6.2831853f / 256.0f);
+            RawGamepad raw;
+            raw.thumbLX = static_cast<int16_t>(std::cos(angle) * 30000.0f);
+            raw.thumbLY = static_cast<int16_t>(std::sin(angle) * 30000.0f);
+            raw.thumbRX = static_cast<int16_t>((seed & 0xFFFF) - 0x8000);
+            raw.thumbRY = static_cast<int16_t>(((seed >> 16) & 0xFFFF) - 0x8000);
+            raw.leftTrigger = static_cast<uint8_t>(seed >> 8);
+            raw.buttons = static_cast<uint16_t>((seed & 7) == 0 ? seed >> 16 : 0);
+            DecodeGamepad(raw, &(*pStates)[i]);
+        }
+    }
+
+    //==========================================================================
+    // `Ƃ̏݁EǂݕԂ
+    //==========================================================================
+    struct FullLayout {
+        typedef GamepadState Entry;
+        static void Write(Entry* pEntry, const GamepadState& state) {
+            *pEntry = state;
+        }
+        static float Read(const Entry& entry) {
+            return entry.leftStickX + entry.rightStickY + entry.leftTrigger + (entry.buttonDown ? 1.0f : 0.0f);
+        }
+    };
+
+    struct CompactLayout {
+        typedef CompactGamepadState Entry;
+        static void Write(Entry* pEntry, const GamepadState& state) {
+            PackGamepadState(state, pEntry);
+        }
+        static float Read(const Entry& entry) {
+            return entry.GetLeftStickX() + entry.GetRightStickY() + entry.GetLeftTrigger() +
+                (entry.IsPressed(PAD_BUTTON_A) ? 1.0f : 0.0f);
+        }
+    };
+
+    struct LayoutResult {
+        double writeNs;     // 1t[i1lj̏
+        double scanNs;      // 1t[i1lj̓ǂݕԂ
+        size_t historyBytes;
+    };
+
+    template<typename Layout>
+    LayoutResult Measure(const std::vector<GamepadState>& source) {
+        typedef typename Layout::Entry Entry;
+        std::vector<Entry> history(static_cast<size_t>(PLAYER_COUNT) * HISTORY_FRAMES);
+
+        // t[SivC[Ƃ̗͕ʁẌ̗j
+        auto begin = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < WRITE_FRAMES; frame++) {
+            size_t slot = static_cast<size_t>(frame) & (HISTORY_FRAMES - 1);
+            for (int player = 0; player < PLAYER_COUNT; player++) {
+                const GamepadState& state = source[(frame + player * 97) & (SOURCE_STATES - 1)];
+                Layout::Write(&history[static_cast<size_t>(player) * HISTORY_FRAMES + slot], state);
+            }
+        }
+        auto middle = std::chrono::steady_clock::now();
+
+        // ŜǂݕԂivCE͂̑j
+        float sum = 0.0f;
+        for (int pass = 0; pass < SCAN_PASSES; pass++) {
+            for (const Entry& entry : history) {
+                sum += Layout::Read(entry);
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+        s_sink = s_sink + sum;
+
+        LayoutResult result;
+        result.writeNs = std::chrono::duration<double, std::nano>(middle - begin).count() /
+            (static_cast<double>(WRITE_FRAMES) * PLAYER_COUNT);
+        result.scanNs = std::chrono::duration<double, std::nano>(end - middle).count() /
+            (static_cast<double>(SCAN_PASSES) * history.size());
+        result.historyBytes = history.size() * sizeof(Entry);
+        return result;
+    }
+
+    void PrintResult(const char* pName, size_t entryBytes, const LayoutResult& result) {
+        printf(" %-20s | %5zu | %8zuKB | %8.2f | %8.2f\n",
+            pName, entryBytes, result.historyBytes / 1024, result.writeNs, result.scanNs);
+    }
+}
+
+//==============================================================================
+// x`}[Ns
+//==============================================================================
+int RunStateLayoutBenchmark() {
+    std::vector<GamepadState> source;
+    BuildSource(&source);
+
+    LayoutResult full = Measure<FullLayout>(source);
+    LayoutResult compact = Measure<CompactLayout>(source);
+
+    printf(" %d players x %d frames of history\n", PLAYER_COUNT, HISTORY_FRAMES);
+    printf(" layout               | bytes |   history | write ns |  scan ns  (per sample)\n");
+    printf("----------------------+-------+-----------+----------+---------\n");
+    PrintResult("GamepadState", sizeof(GamepadState), full);
+    PrintResult("CompactGamepadState", sizeof(CompactGamepadState), compact);
+    return 0;
+}
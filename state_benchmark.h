@@ -0,0 +1,14 @@
+/*****************************************************************//**
+ * \file   state_benchmark.h
+ * \brief  obt@ɒuԂ̌`̑xriGamepadStateCompactGamepadStatej
+ *
+ * 4l̗Oɖt[̏ԂޑxƁAŜ
+ * ǂݕԂx𑪂BCompactGamepadState͏Ƃɋl߁A
+ * ǂނƂfloat֖߂vɊ܂߂B
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+
+// x`}[NsČʂ\i0Ԃj
+int RunStateLayoutBenchmark();
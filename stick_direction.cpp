@@ -0,0 +1,129 @@
+/*****************************************************************//**
+ * \file   stick_direction.cpp
+ * \brief  XeBbN4E8ւ̕ϊipx̃qXeVXtj
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "stick_direction.h"
+#include <cmath>
+#include "gamepad_state.h"
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // px\̈ӂ̃}Xi-1 ~ 1̐ɕj
+    constexpr int GRID_SIZE = 128;
+    // 1̒iKiuint8_ťӂł̂܂܈j
+    constexpr int ANGLE_STEPS = 256;
+
+    // Ƃ̏\L[̃rbgiSTICK_DIR_*̏j
+    const uint32_t DIRECTION_DPAD[] = {
+        0,
+        PAD_BUTTON_DPAD_RIGHT,
+        PAD_BUTTON_DPAD_UP | PAD_BUTTON_DPAD_RIGHT,
+        PAD_BUTTON_DPAD_UP,
+        PAD_BUTTON_DPAD_UP | PAD_BUTTON_DPAD_LEFT,
+        PAD_BUTTON_DPAD_LEFT,
+        PAD_BUTTON_DPAD_DOWN | PAD_BUTTON_DPAD_LEFT,
+        PAD_BUTTON_DPAD_DOWN,
+        PAD_BUTTON_DPAD_DOWN | PAD_BUTTON_DPAD_RIGHT,
+    };
+
+    const char* const DIRECTION_NAMES[] = {
+        "-", "RIGHT", "UP-RIGHT", "UP", "UP-LEFT", "LEFT", "DOWN-LEFT", "DOWN", "DOWN-RIGHT",
+    };
+
+    // }XƂ̊pxiE0AvAオ64j
+    struct AngleTable {
+        uint8_t angle[GRID_SIZE * GRID_SIZE];
+
+        AngleTable() {
+            const double TWO_PI = 6.283185307179586;
+            for (int iy = 0; iy < GRID_SIZE; iy++) {
+                // }X̒S̍WiY͏オȂ̂Ŕ]ď𐳂ɂj
+                double y = -((iy + 0.5) * 2.0 / GRID_SIZE - 1.0);
+                for (int ix = 0; ix < GRID_SIZE; ix++) {
+                    double x = (ix + 0.5) * 2.0 / GRID_SIZE - 1.0;
+                    double turns = std::atan2(y, x) / TWO_PI;
+                    int step = static_cast<int>(std::floor(turns * ANGLE_STEPS + 0.5));
+                    angle[iy * GRID_SIZE + ix] = static_cast<uint8_t>(step & (ANGLE_STEPS - 1));
+                }
+            }
+        }
+    };
+
+    // ߂ĎgƂɈx
+    const AngleTable& GetAngleTable() {
+        static const AngleTable s_table;
+        return s_table;
+    }
+
+    // -1 ~ 1}Xԍ
+    inline int ToCell(float value) {
+        int cell = static_cast<int>((value + 1.0f) * (GRID_SIZE / 2));
+        if (cell < 0) return 0;
+        if (cell > GRID_SIZE - 1) return GRID_SIZE - 1;
+        return cell;
+    }
+}
+
+//==============================================================================
+// ̕ϊ
+//==============================================================================
+uint32_t StickDirectionToDpad(StickDirection direction) {
+    return DIRECTION_DPAD[direction];
+}
+
+const char* GetStickDirectionName(StickDirection direction) {
+    return DIRECTION_NAMES[direction];
+}
+
+//==============================================================================
+// ݒ
+//==============================================================================
+void StickQuantizer::SetSettings(const StickDirectionSettings& settings) {
+    m_settings = settings;
+    if (m_settings.ways != 4) {
+        m_settings.ways = 8;
+    }
+    // LƗׂ̋؂ẑŋ؂̔ɗ}
+    int sector = ANGLE_STEPS / m_settings.ways;
+    int hysteresis = static_cast<int>(m_settings.hysteresisDegrees * ANGLE_STEPS / 360.0f + 0.5f);
+    if (hysteresis < 0) hysteresis = 0;
+    if (hysteresis > sector / 2 - 1) hysteresis = sector / 2 - 1;
+    m_hysteresis = hysteresis;
+    Reset();
+}
+
+//==============================================================================
+// XV
+//==============================================================================
+StickDirection StickQuantizer::Update(float stickX, float stickY) {
+    m_prevDirection = m_direction;
+
+    // |iƂƔƂłlςj
+    float threshold = (m_direction == STICK_DIR_NEUTRAL) ? m_settings.pressThreshold : m_settings.releaseThreshold;
+    if (stickX * stickX + stickY * stickY < threshold * threshold) {
+        m_direction = STICK_DIR_NEUTRAL;
+        return m_direction;
+    }
+
+    int angle = GetAngleTable().angle[ToCell(stickY) * GRID_SIZE + ToCell(stickX)];
+    int sector = ANGLE_STEPS / m_settings.ways;
+    int step = 8 / m_settings.ways;     // ؂ԍSTICK_DIR_*ւ̔{
+
+    // Ő̕؂L͈͂ɓĂ΂̂܂
+    if (m_direction != STICK_DIR_NEUTRAL && (m_direction - 1) % step == 0) {
+        int center = (m_direction - 1) / step * sector;
+        int diff = static_cast<int8_t>(static_cast<uint8_t>(angle - center));
+        if (diff < 0) diff = -diff;
+        if (diff <= sector / 2 + m_hysteresis) {
+            return m_direction;
+        }
+    }
+
+    int index = ((angle + sector / 2) & (ANGLE_STEPS - 1)) / sector;
+    m_direction = static_cast<StickDirection>(STICK_DIR_RIGHT + index * step);
+    return m_direction;
+}
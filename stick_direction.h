@@ -0,0 +1,74 @@
+/*****************************************************************//**
+ * \file   stick_direction.h
+ * \brief  XeBbN4E8ւ̕ϊipx̃qXeVXtj
+ *
+ * XeBbN̒l128~128̃}XɗʎqA}XƂ̊pxi1256iKj
+ * 炩ߕ\ɂĂBs͕\1ċ؂Ŋ邾ŁA
+ * Op֐͎gȂB
+ *
+ * ؂̋ڂŃ`Ȃ悤AO͂̋̕؂
+ * qXeVX̕LĔ肷B|AƂ
+ * Ƃłl𕪂B
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+
+//==============================================================================
+// iE甽vj
+//==============================================================================
+enum StickDirection {
+    STICK_DIR_NEUTRAL = 0,
+    STICK_DIR_RIGHT,
+    STICK_DIR_UP_RIGHT,
+    STICK_DIR_UP,
+    STICK_DIR_UP_LEFT,
+    STICK_DIR_LEFT,
+    STICK_DIR_DOWN_LEFT,
+    STICK_DIR_DOWN,
+    STICK_DIR_DOWN_RIGHT,
+};
+
+// \L[̃rbgiPAD_BUTTON_DPAD_*jɕϊ
+uint32_t StickDirectionToDpad(StickDirection direction);
+// \p̖Oi"RIGHT"ȂǁAj[g"-"j
+const char* GetStickDirectionName(StickDirection direction);
+
+//==============================================================================
+// ϊݒ
+//==============================================================================
+struct StickDirectionSettings {
+    int ways = 8;                   // 48
+    float pressThreshold = 0.5f;    // |
+    float releaseThreshold = 0.4f;  // j[gɖ߂|
+    float hysteresisDegrees = 8.0f; // Ő̕؂БɍLpx
+};
+
+//==============================================================================
+// ϊNX
+//==============================================================================
+class StickQuantizer {
+public:
+    StickQuantizer() { SetSettings(StickDirectionSettings()); }
+
+    void Reset() {
+        m_direction = STICK_DIR_NEUTRAL;
+        m_prevDirection = STICK_DIR_NEUTRAL;
+    }
+    void SetSettings(const StickDirectionSettings& settings);
+    const StickDirectionSettings& GetSettings() const { return m_settings; }
+
+    // fR[h̃XeBbNliY͏オjXVĕԂ
+    StickDirection Update(float stickX, float stickY);
+
+    StickDirection GetDirection() const { return m_direction; }
+    StickDirection GetPrevDirection() const { return m_prevDirection; }
+    bool IsChanged() const { return m_direction != m_prevDirection; }
+
+private:
+    StickDirectionSettings m_settings;
+    int m_hysteresis;               // px̍Li1256iKj
+    StickDirection m_direction;
+    StickDirection m_prevDirection;
+};
@@ -0,0 +1,197 @@
+/*****************************************************************//**
+ * \file   stick_plot.cpp
+ * \brief  XeBbN̋OՂ_ŕ`2Dvbg
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "stick_plot.h"
+#include <cmath>
+#include <cstring>
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // _̐擪̕
+    constexpr wchar_t BRAILLE_BASE = 0x2800;
+    // ̓_̈ʒui[s][]jƃrbg
+    constexpr uint8_t BRAILLE_BITS[4][2] = {
+        { 0x01, 0x08 },
+        { 0x02, 0x10 },
+        { 0x04, 0x20 },
+        { 0x40, 0x80 },
+    };
+
+    // ̐FiVOՁEÂOՁE~j
+    constexpr WORD ATTRIBUTE_RECENT = FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE | FOREGROUND_INTENSITY;
+    constexpr WORD ATTRIBUTE_OLD = FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE;
+    constexpr WORD ATTRIBUTE_GUIDE = FOREGROUND_INTENSITY;
+
+    // Ỏ~`Ƃ̕
+    constexpr int GUIDE_STEPS = 256;
+
+    constexpr uint32_t ALL_CELLS = (1u << StickPlot::CELL_COLUMNS) - 1;
+}
+
+//==============================================================================
+// EI
+//==============================================================================
+StickPlot::StickPlot() {
+    // Ỏ~ƒS
+    memset(m_guideBits, 0, sizeof(m_guideBits));
+    for (int i = 0; i < GUIDE_STEPS; i++) {
+        float angle = 6.2831853f * i / GUIDE_STEPS;
+        int dot = ToDot(std::cos(angle), std::sin(angle));
+        int dotX = dot % DOT_COLUMNS;
+        int dotY = dot / DOT_COLUMNS;
+        m_guideBits[(dotY / 4) * CELL_COLUMNS + dotX / 2] |= BRAILLE_BITS[dotY % 4][dotX % 2];
+    }
+    int center = ToDot(0.0f, 0.0f);
+    m_guideBits[(center / DOT_COLUMNS / 4) * CELL_COLUMNS + (center % DOT_COLUMNS) / 2] |=
+        BRAILLE_BITS[(center / DOT_COLUMNS) % 4][(center % DOT_COLUMNS) % 2];
+
+    memset(m_trailCounts, 0, sizeof(m_trailCounts));
+    memset(m_recentCounts, 0, sizeof(m_recentCounts));
+    Invalidate();
+}
+
+bool StickPlot::Initialize(int trailLength, int recentLength) {
+    Finalize();
+    if (trailLength <= 0 || trailLength > MAX_TRAIL) {
+        return false;
+    }
+    m_pRing = new uint16_t[trailLength];
+    m_trailLength = trailLength;
+    m_recentLength = (recentLength < trailLength) ? recentLength : trailLength;
+    Clear();
+    return true;
+}
+
+void StickPlot::Finalize() {
+    delete[] m_pRing;
+    m_pRing = nullptr;
+    m_trailLength = 0;
+    m_recentLength = 0;
+    Clear();
+}
+
+void StickPlot::Clear() {
+    memset(m_trailCounts, 0, sizeof(m_trailCounts));
+    memset(m_recentCounts, 0, sizeof(m_recentCounts));
+    m_head = 0;
+    m_count = 0;
+    Invalidate();
+}
+
+void StickPlot::Invalidate() {
+    for (uint32_t& row : m_dirtyRows) {
+        row = ALL_CELLS;
+    }
+}
+
+//==============================================================================
+// Tv̒ǉ
+//==============================================================================
+void StickPlot::AddSample(float x, float y) {
+    if (m_pRing == nullptr) {
+        return;
+    }
+
+    // VOTvirecentLengthOj
+    if (m_count >= m_recentLength && m_recentLength > 0) {
+        int index = m_head - m_recentLength;
+        if (index < 0) index += m_trailLength;
+        ChangeCount(m_pRing[index], m_recentCounts, -1);
+    }
+    // OՂ牟oTviO̓ʒuj
+    if (m_count == m_trailLength) {
+        ChangeCount(m_pRing[m_head], m_trailCounts, -1);
+    } else {
+        m_count++;
+    }
+
+    int dot = ToDot(x, y);
+    m_pRing[m_head] = static_cast<uint16_t>(dot);
+    ChangeCount(dot, m_trailCounts, 1);
+    if (m_recentLength > 0) {
+        ChangeCount(dot, m_recentCounts, 1);
+    }
+    m_head = (m_head + 1 < m_trailLength) ? m_head + 1 : 0;
+}
+
+// -1.0 ~ 1.0_̔ԍցi͈͊O͒[Ɋ񂹂j
+int StickPlot::ToDot(float x, float y) const {
+    int dotX = static_cast<int>((x + 1.0f) * 0.5f * DOT_COLUMNS);
+    int dotY = static_cast<int>((y + 1.0f) * 0.5f * DOT_ROWS);
+    if (dotX < 0) dotX = 0;
+    if (dotX > DOT_COLUMNS - 1) dotX = DOT_COLUMNS - 1;
+    if (dotY < 0) dotY = 0;
+    if (dotY > DOT_ROWS - 1) dotY = DOT_ROWS - 1;
+    return dotY * DOT_COLUMNS + dotX;
+}
+
+StickPlot::DotAge StickPlot::GetDotAge(int dot) const {
+    if (m_recentCounts[dot] > 0) return DOT_RECENT;
+    if (m_trailCounts[dot] > 0) return DOT_OLD;
+    return DOT_EMPTY;
+}
+
+// 𑝌A_̌ڂς當Ώۂɂ
+void StickPlot::ChangeCount(int dot, int16_t* pCounts, int delta) {
+    DotAge before = GetDotAge(dot);
+    pCounts[dot] = static_cast<int16_t>(pCounts[dot] + delta);
+    if (GetDotAge(dot) != before) {
+        int dotX = dot % DOT_COLUMNS;
+        int dotY = dot / DOT_COLUMNS;
+        m_dirtyRows[dotY / 4] |= 1u << (dotX / 2);
+    }
+}
+
+//==============================================================================
+// o
+//==============================================================================
+int StickPlot::Present(HANDLE hConsole, int x, int y) {
+    int written = 0;
+    wchar_t text[CELL_COLUMNS];
+    WORD attributes[CELL_COLUMNS];
+
+    for (int row = 0; row < CELL_ROWS; row++) {
+        uint32_t dirty = m_dirtyRows[row];
+        if (dirty == 0) {
+            continue;
+        }
+        m_dirtyRows[row] = 0;
+
+        // Ώۂ̍ŏƍŌ̊̕Ԃ1ŏ
+        int first = 0;
+        while ((dirty & (1u << first)) == 0) first++;
+        int last = CELL_COLUMNS - 1;
+        while ((dirty & (1u << last)) == 0) last--;
+
+        for (int column = first; column <= last; column++) {
+            uint8_t bits = 0;
+            DotAge age = DOT_EMPTY;
+            for (int dotY = 0; dotY < 4; dotY++) {
+                for (int dotX = 0; dotX < 2; dotX++) {
+                    DotAge dotAge = GetDotAge((row * 4 + dotY) * DOT_COLUMNS + column * 2 + dotX);
+                    if (dotAge != DOT_EMPTY) {
+                        bits |= BRAILLE_BITS[dotY][dotX];
+                        if (dotAge > age) age = dotAge;
+                    }
+                }
+            }
+            int index = column - first;
+            text[index] = static_cast<wchar_t>(BRAILLE_BASE + (bits | m_guideBits[row * CELL_COLUMNS + column]));
+            attributes[index] = (age == DOT_RECENT) ? ATTRIBUTE_RECENT : ((age == DOT_OLD) ? ATTRIBUTE_OLD : ATTRIBUTE_GUIDE);
+        }
+
+        // ݈ʒuw肷o͂Ȃ̂ŃJ[\͓Ȃ
+        DWORD length = static_cast<DWORD>(last - first + 1);
+        DWORD count = 0;
+        COORD coord = { static_cast<SHORT>(x + first), static_cast<SHORT>(y + row) };
+        WriteConsoleOutputCharacterW(hConsole, text, length, coord, &count);
+        WriteConsoleOutputAttribute(hConsole, attributes, length, coord, &count);
+        written += static_cast<int>(length);
+    }
+    return written;
+}
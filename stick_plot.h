@@ -0,0 +1,84 @@
+/*****************************************************************//**
+ * \file   stick_plot.h
+ * \brief  XeBbN̋OՂ_ŕ`2Dvbg
+ *
+ * _iU+2800 ~ U+28FFj12x4̓_̂ŁA20x10
+ * 40x40_̕ʂɂȂBNTv̈ʒu_ŎcAÂ̂
+ * OՂƂĕ`BỎ~ƒS͔`Ă̂ŁA
+ * ~̂iOlpEĂjAhtgiĂS
+ * ߂ȂjAfbh][̌`iSt߂̋󔒁jĕB
+ *
+ * XV͍ōs
+ *   - _ƂɁuNTv̂ɂ邩v𐔂A
+ *     Tv̒ǉƉo1iŜ`Ȃj
+ *   - _̗LEVςΏۂɂA
+ *     Present()ł͏Ώۂ̂s͈̔͂R\[֏
+ *
+ * V2iKŕ\i߂̈ꕔ͖邭AÂ͈̂ÂjB
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#include <windows.h>
+#include <cstdint>
+
+//==============================================================================
+// XeBbNvbgNX
+//==============================================================================
+class StickPlot {
+public:
+    // i_͉2{Ec4{j
+    static constexpr int CELL_COLUMNS = 20;
+    static constexpr int CELL_ROWS = 10;
+    static constexpr int DOT_COLUMNS = CELL_COLUMNS * 2;
+    static constexpr int DOT_ROWS = CELL_ROWS * 4;
+    // cTv̏
+    static constexpr int MAX_TRAIL = 4096;
+
+    StickPlot();
+    ~StickPlot() { Finalize(); }
+    StickPlot(const StickPlot&) = delete;
+    StickPlot& operator=(const StickPlot&) = delete;
+
+    // trailLength: cTvArecentLength: ̂邭`VTv
+    bool Initialize(int trailLength, int recentLength);
+    void Finalize();
+    // OՂiỎ~͎cj
+    void Clear();
+
+    // Tvǉi-1.0 ~ 1.0Ay͉+GamepadStateƓj
+    void AddSample(float x, float y);
+    int GetSampleCount() const { return m_count; }
+
+    // ς(x, y)ƂăR\[֏i߂l͏j
+    int Present(HANDLE hConsole, int x, int y);
+    // Present()őŜiʂ𑼂̏o͂ŏ㏑Ƃj
+    void Invalidate();
+
+private:
+    enum DotAge : uint8_t {
+        DOT_EMPTY,
+        DOT_OLD,
+        DOT_RECENT,
+    };
+
+    int ToDot(float x, float y) const;
+    DotAge GetDotAge(int dot) const;
+    void ChangeCount(int dot, int16_t* pCounts, int delta);
+
+    // _Ƃ̌im_trailCounts͒NTvAm_recentCounts͂̂Vj
+    int16_t m_trailCounts[DOT_COLUMNS * DOT_ROWS];
+    int16_t m_recentCounts[DOT_COLUMNS * DOT_ROWS];
+    // Ỏ~ES̓_iɔ`j
+    uint8_t m_guideBits[CELL_COLUMNS * CELL_ROWS];
+
+    // TṽOi_̔ԍj
+    uint16_t* m_pRing = nullptr;
+    int m_trailLength = 0;
+    int m_recentLength = 0;
+    int m_head = 0;             // ɏʒu
+    int m_count = 0;
+
+    // Ώۂ̕isƂ̃rbgj
+    uint32_t m_dirtyRows[CELL_ROWS];
+};
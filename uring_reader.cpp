@@ -0,0 +1,340 @@
+/*****************************************************************//**
+ * \file   uring_reader.cpp
+ * \brief  io_uringŕhidrawfoCXǂޓǂݍ݃[v
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#include "uring_reader.h"
+
+#ifdef __linux__
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <linux/time_types.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+//==============================================================================
+// 萔`
+//==============================================================================
+namespace {
+    // L[̒iSfoCX̓ǂݍ݁{j
+    constexpr unsigned RING_ENTRIES = 128;
+
+    // v̊ɕtiǂݍ݂̓Xbgԍ{1j
+    constexpr uint64_t CANCEL_USER_DATA = ~0ull;
+
+    // LO̓ǂݏiJ[lƏ킹j
+    inline unsigned LoadAcquire(const unsigned* p) {
+        return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+    }
+    inline void StoreRelease(unsigned* p, unsigned value) {
+        __atomic_store_n(p, value, __ATOMIC_RELEASE);
+    }
+
+    inline unsigned* RingField(void* pRing, uint32_t offset) {
+        return reinterpret_cast<unsigned*>(static_cast<uint8_t*>(pRing) + offset);
+    }
+}
+
+//==============================================================================
+// EI
+//==============================================================================
+bool UringInputReader::Initialize() {
+    Finalize();
+
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    int fd = static_cast<int>(syscall(__NR_io_uring_setup, RING_ENTRIES, &params));
+    if (fd < 0) {
+        return false;
+    }
+    m_ringFd = fd;
+
+    m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (singleMap) {
+        if (m_cqRingSize > m_sqRingSize) m_sqRingSize = m_cqRingSize;
+        m_cqRingSize = m_sqRingSize;
+    }
+
+    m_pSqRing = mmap(nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (m_pSqRing == MAP_FAILED) {
+        m_pSqRing = nullptr;
+        Finalize();
+        return false;
+    }
+    m_pCqRing = singleMap ? m_pSqRing :
+        mmap(nullptr, m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+    if (m_pCqRing == MAP_FAILED) {
+        m_pCqRing = nullptr;
+        Finalize();
+        return false;
+    }
+    m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    void* pSqes = mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (pSqes == MAP_FAILED) {
+        Finalize();
+        return false;
+    }
+    m_pSqes = static_cast<io_uring_sqe*>(pSqes);
+
+    m_pSqHead = RingField(m_pSqRing, params.sq_off.head);
+    m_pSqTail = RingField(m_pSqRing, params.sq_off.tail);
+    m_pSqArray = RingField(m_pSqRing, params.sq_off.array);
+    m_sqMask = *RingField(m_pSqRing, params.sq_off.ring_mask);
+    m_sqEntries = params.sq_entries;
+    m_pCqHead = RingField(m_pCqRing, params.cq_off.head);
+    m_pCqTail = RingField(m_pCqRing, params.cq_off.tail);
+    m_pCqes = reinterpret_cast<io_uring_cqe*>(static_cast<uint8_t*>(m_pCqRing) + params.cq_off.cqes);
+    m_cqMask = *RingField(m_pCqRing, params.cq_off.ring_mask);
+
+    m_pBuffers = new uint8_t[MAX_DEVICES * SLOT_BUFFER_SIZE];
+    return true;
+}
+
+void UringInputReader::Finalize() {
+    // o܂܂̓ǂݍ݂obt@gI܂ő҂Ă
+    for (int slot = 0; slot < MAX_DEVICES; slot++) {
+        if (m_pDevices[slot] != nullptr) {
+            RemoveDevice(slot);
+        }
+    }
+
+    if (m_pSqes != nullptr) {
+        munmap(m_pSqes, m_sqesSize);
+        m_pSqes = nullptr;
+    }
+    if (m_pCqRing != nullptr && m_pCqRing != m_pSqRing) {
+        munmap(m_pCqRing, m_cqRingSize);
+    }
+    m_pCqRing = nullptr;
+    if (m_pSqRing != nullptr) {
+        munmap(m_pSqRing, m_sqRingSize);
+        m_pSqRing = nullptr;
+    }
+    if (m_ringFd >= 0) {
+        close(m_ringFd);
+        m_ringFd = -1;
+    }
+    m_pendingSubmit = 0;
+    delete[] m_pBuffers;
+    m_pBuffers = nullptr;
+}
+
+//==============================================================================
+// L[
+//==============================================================================
+io_uring_sqe* UringInputReader::GetSqe() {
+    unsigned tail = *m_pSqTail;
+    if (tail - LoadAcquire(m_pSqHead) >= m_sqEntries) {
+        // tȂɏoĂ܂
+        Enter(0, 0);
+        if (tail - LoadAcquire(m_pSqHead) >= m_sqEntries) {
+            return nullptr;
+        }
+    }
+    unsigned index = tail & m_sqMask;
+    io_uring_sqe* pSqe = &m_pSqes[index];
+    memset(pSqe, 0, sizeof(*pSqe));
+    m_pSqArray[index] = index;
+    StoreRelease(m_pSqTail, tail + 1);
+    m_pendingSubmit++;
+    return pSqe;
+}
+
+void UringInputReader::QueueRead(int slot) {
+    io_uring_sqe* pSqe = GetSqe();
+    if (pSqe == nullptr) {
+        return;
+    }
+    pSqe->opcode = IORING_OP_READ;
+    pSqe->fd = m_pDevices[slot]->GetFd();
+    pSqe->addr = reinterpret_cast<uint64_t>(m_pBuffers + slot * SLOT_BUFFER_SIZE);
+    pSqe->len = static_cast<uint32_t>(SLOT_BUFFER_SIZE);
+    pSqe->off = ~0ull;      // t@CʒugȂipCvELN^[foCXj
+    pSqe->user_data = static_cast<uint64_t>(slot) + 1;
+    m_readPending[slot] = true;
+}
+
+int UringInputReader::Enter(unsigned minComplete, int timeoutMs) {
+    unsigned flags = (minComplete > 0) ? IORING_ENTER_GETEVENTS : 0;
+    void* pArg = nullptr;
+    size_t argSize = 0;
+
+    __kernel_timespec timeout = {};
+    io_uring_getevents_arg eventsArg = {};
+    if (minComplete > 0 && timeoutMs >= 0) {
+        timeout.tv_sec = timeoutMs / 1000;
+        timeout.tv_nsec = (timeoutMs % 1000) * 1000000LL;
+        eventsArg.sigmask_sz = _NSIG / 8;
+        eventsArg.ts = reinterpret_cast<uint64_t>(&timeout);
+        flags |= IORING_ENTER_EXT_ARG;
+        pArg = &eventsArg;
+        argSize = sizeof(eventsArg);
+    }
+
+    int result;
+    do {
+        result = static_cast<int>(syscall(__NR_io_uring_enter, m_ringFd, m_pendingSubmit, minComplete, flags, pArg, argSize));
+    } while (result < 0 && errno == EINTR);
+    m_enterCount++;
+    if (result > 0) {
+        m_pendingSubmit -= (static_cast<unsigned>(result) < m_pendingSubmit) ? static_cast<unsigned>(result) : m_pendingSubmit;
+    }
+    return result;
+}
+
+//==============================================================================
+// L[iLǂނŃVXeR[͎gȂj
+//==============================================================================
+int UringInputReader::Reap() {
+    unsigned head = *m_pCqHead;
+    unsigned tail = LoadAcquire(m_pCqTail);
+    int completed = 0;
+    while (head != tail) {
+        const io_uring_cqe& cqe = m_pCqes[head & m_cqMask];
+        head++;
+        m_completionCount++;
+        if (cqe.user_data == CANCEL_USER_DATA) {
+            continue;
+        }
+
+        int slot = static_cast<int>(cqe.user_data - 1);
+        m_readPending[slot] = false;
+        HidrawDevice* pDevice = m_pDevices[slot];
+        if (pDevice == nullptr) {
+            continue;
+        }
+        completed++;
+
+        // ̃XbǵAubLO̓ǂݍ݂-EINTRŕԂĂĂǂݒȂ
+        if (m_removing[slot]) {
+            if (cqe.res > 0) {
+                pDevice->Consume(m_pBuffers + slot * SLOT_BUFFER_SIZE, static_cast<size_t>(cqe.res));
+            }
+            continue;
+        }
+
+        if (cqe.res > 0) {
+            if (pDevice->Consume(m_pBuffers + slot * SLOT_BUFFER_SIZE, static_cast<size_t>(cqe.res)) > 0) {
+                m_updatedMask |= 1ull << slot;
+            }
+            QueueRead(slot);
+        } else if (cqe.res == -EAGAIN || cqe.res == -EINTR) {
+            QueueRead(slot);
+        } else if (cqe.res != -ECANCELED) {
+            // 0iݑjfoCX̃G[͐ؒf
+            Disconnect(slot);
+        }
+    }
+    StoreRelease(m_pCqHead, head);
+    return completed;
+}
+
+//==============================================================================
+// foCXo^
+//==============================================================================
+int UringInputReader::AddDevice(HidrawDevice* pDevice) {
+    if (m_ringFd < 0 || pDevice == nullptr || !pDevice->IsOpen()) {
+        return -1;
+    }
+
+    int slot = 0;
+    while (slot < MAX_DEVICES && m_pDevices[slot] != nullptr) {
+        slot++;
+    }
+    if (slot == MAX_DEVICES) {
+        return -1;
+    }
+
+    int fd = pDevice->GetFd();
+    m_savedFlags[slot] = fcntl(fd, F_GETFL);
+    fcntl(fd, F_SETFL, m_savedFlags[slot] & ~O_NONBLOCK);
+
+    m_pDevices[slot] = pDevice;
+    m_deviceCount++;
+    QueueRead(slot);
+    return slot;
+}
+
+void UringInputReader::RemoveDevice(int slot) {
+    HidrawDevice* pDevice = m_pDevices[slot];
+    if (pDevice == nullptr) {
+        return;
+    }
+
+    // o܂܂̓ǂݍ݂AԂ܂ő҂iobt@ėp邽߁j
+    m_removing[slot] = true;
+    if (m_readPending[slot]) {
+        io_uring_sqe* pSqe = GetSqe();
+        if (pSqe != nullptr) {
+            pSqe->opcode = IORING_OP_ASYNC_CANCEL;
+            pSqe->addr = static_cast<uint64_t>(slot) + 1;
+            pSqe->user_data = CANCEL_USER_DATA;
+        }
+        while (m_readPending[slot]) {
+            if (Enter(1, -1) < 0) {
+                break;
+            }
+            Reap();
+        }
+    }
+
+    // Reap()̒ŐؒfɂȂĂΓo^͂OĂ
+    m_removing[slot] = false;
+    pDevice = m_pDevices[slot];
+    if (pDevice == nullptr) {
+        return;
+    }
+    if (pDevice->IsOpen()) {
+        fcntl(pDevice->GetFd(), F_SETFL, m_savedFlags[slot]);
+    }
+    m_pDevices[slot] = nullptr;
+    m_deviceCount--;
+}
+
+void UringInputReader::Disconnect(int slot) {
+    m_pDevices[slot]->Close();
+    m_pDevices[slot] = nullptr;
+    m_deviceCount--;
+    m_disconnectedMask |= 1ull << slot;
+}
+
+//==============================================================================
+// 󂯎Ɠǂݒ
+//==============================================================================
+int UringInputReader::Poll(int timeoutMs) {
+    m_updatedMask = 0;
+    m_disconnectedMask = 0;
+    if (m_ringFd < 0) {
+        return 0;
+    }
+
+    // ͂ĂȂ΁Aǂݒołɑ҂
+    int completed = Reap();
+    if (completed == 0 && timeoutMs != 0 && m_deviceCount > 0) {
+        Enter(1, timeoutMs);
+        completed = Reap();
+    }
+
+    // ǂݒoƗ܂Ă͂̏Ŋ̂ŁAȂȂ܂ŌJԂ
+    for (int round = 0; round < MAX_ROUNDS && m_pendingSubmit > 0; round++) {
+        Enter(0, 0);
+        if (Reap() == 0) {
+            break;
+        }
+    }
+
+    int updated = 0;
+    for (uint64_t mask = m_updatedMask; mask != 0; mask &= mask - 1) {
+        updated++;
+    }
+    return updated;
+}
+
+#endif // __linux__
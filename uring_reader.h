@@ -0,0 +1,106 @@
+/*****************************************************************//**
+ * \file   uring_reader.h
+ * \brief  io_uringŕhidrawfoCXǂޓǂݍ݃[v
+ *
+ * foCXƂread()1ɃJ[l֏oĂA͂̂
+ * L[܂Ƃ߂Ď󂯎BL[͋LȂ̂ŁA
+ * 󂯎邾ȂVXeR[͗vȂBǂݒ̈˗1t[
+ * ܂Ƃ߂1io_uring_enter()ŏoBfR[hEpollInputReaderƓ
+ * HidrawDevice::Consume()ʂB
+ *
+ * liburing͎g킸AVXeR[ƋLO𒼐ڈB
+ * o^fd̓ubLOɐ؂ւiO_NONBLOCK̂܂܂io_uring
+ * f[^҂-EAGAINԂ߁jBOƂɌɖ߂B
+ *
+ * \date   2026/1/5
+ *********************************************************************/
+#pragma once
+#ifdef __linux__
+#include <cstddef>
+#include <cstdint>
+#include "hidraw_device.h"
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+//==============================================================================
+// io_uringǂݍ݃[vNX
+//==============================================================================
+class UringInputReader {
+public:
+    // o^łfoCXiXVꂽfoCX̓rbg}XNŕԂj
+    static constexpr int MAX_DEVICES = 64;
+    // foCXƂ̓ǂݍ݃obt@
+    static constexpr size_t SLOT_BUFFER_SIZE = 4096;
+    // 1Poll()Ŏ󂯎聨ǂݒJԂ
+    static constexpr int MAX_ROUNDS = 4;
+
+    UringInputReader() = default;
+    ~UringInputReader() { Finalize(); }
+    UringInputReader(const UringInputReader&) = delete;
+    UringInputReader& operator=(const UringInputReader&) = delete;
+
+    // io_uringgȂfalseiJ[lÂEɂĂȂǁj
+    bool Initialize();
+    void Finalize();
+
+    // foCXo^ăXbgԍԂitȂ-1j
+    int AddDevice(HidrawDevice* pDevice);
+    void RemoveDevice(int slot);
+    HidrawDevice* GetDevice(int slot) const { return m_pDevices[slot]; }
+    int GetDeviceCount() const { return m_deviceCount; }
+
+    // ͂󂯎ēǂݒoitimeoutMs0ő҂ȂA-1łƑ҂j
+    // ߂l͏ԂXVꂽfoCXAؒfꂽfoCX͎œo^O
+    int Poll(int timeoutMs);
+
+    // ߂Poll()ōXVꂽEؒfꂽXbgirbgƁj
+    uint64_t GetUpdatedMask() const { return m_updatedMask; }
+    uint64_t GetDisconnectedMask() const { return m_disconnectedMask; }
+
+    // viVXeR[̉񐔂̊mFpj
+    uint64_t GetEnterCount() const { return m_enterCount; }
+    uint64_t GetCompletionCount() const { return m_completionCount; }
+
+private:
+    io_uring_sqe* GetSqe();
+    void QueueRead(int slot);
+    int Enter(unsigned minComplete, int timeoutMs);
+    int Reap();
+    void Disconnect(int slot);
+
+    int m_ringFd = -1;
+    unsigned m_pendingSubmit = 0;
+
+    // LO
+    void* m_pSqRing = nullptr;
+    void* m_pCqRing = nullptr;
+    size_t m_sqRingSize = 0;
+    size_t m_cqRingSize = 0;
+    io_uring_sqe* m_pSqes = nullptr;
+    size_t m_sqesSize = 0;
+    unsigned* m_pSqHead = nullptr;
+    unsigned* m_pSqTail = nullptr;
+    unsigned* m_pSqArray = nullptr;
+    unsigned m_sqMask = 0;
+    unsigned m_sqEntries = 0;
+    unsigned* m_pCqHead = nullptr;
+    unsigned* m_pCqTail = nullptr;
+    io_uring_cqe* m_pCqes = nullptr;
+    unsigned m_cqMask = 0;
+
+    // foCX
+    HidrawDevice* m_pDevices[MAX_DEVICES] = {};
+    bool m_readPending[MAX_DEVICES] = {};
+    bool m_removing[MAX_DEVICES] = {};      // iĂǂݒȂj
+    int m_savedFlags[MAX_DEVICES] = {};
+    int m_deviceCount = 0;
+    uint8_t* m_pBuffers = nullptr;
+
+    uint64_t m_updatedMask = 0;
+    uint64_t m_disconnectedMask = 0;
+    uint64_t m_enterCount = 0;
+    uint64_t m_completionCount = 0;
+};
+
+#endif // __linux__